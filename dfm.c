@@ -40,7 +40,9 @@
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <fnmatch.h>
 #include <limits.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -49,6 +51,7 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -56,13 +59,17 @@
 #include "lib/arg.h"
 #include "lib/bitset.h"
 #include "lib/date.h"
+#include "lib/fs.h"
+#include "lib/journal.h"
 #include "lib/readline.h"
 #include "lib/str.h"
 #include "lib/term.h"
 #include "lib/term_key.h"
+#include "lib/trash.h"
 #include "lib/utf8.h"
 #include "lib/util.h"
 #include "lib/vt.h"
+#include "lib/walk.h"
 
 #if defined(__linux__)
 #include "platform/linux.h"
@@ -103,10 +110,11 @@ static const char DFM_HELP[] =
   "DFM_OPENER         program used to open files (overridden by -o)\n"
   "DFM_BOOKMARK_[0-9] bookmark directories\n"
   "DFM_COPYER         program used to copy PWD and file contents.\n"
-  "DFM_TRASH          program used to trash files.\n"
-  "DFM_TRASH_DIR      path to trash directory.\n"
+  "DFM_TRASH          program used to trash files (if configured).\n"
+  "DFM_TRASH_DIR      path to trash directory (default: XDG home trash).\n"
   "DFM_IMG_MODE       image made to use ('chafa', 'kitty')\n"
   "DFM_SU             privilege escalation tool to use ('sudo', 'doas', ...)\n"
+  "EDITOR             editor used to bulk rename (default: vi)\n"
 ;
 
 enum fm_opt {
@@ -131,12 +139,46 @@ enum fm_opt {
   FM_SEARCH       = 1 << 15,
   FM_PWD_UTF8     = 1 << 16,
   FM_PWD_CTRL     = 1 << 17,
+  FM_FIND         = 1 << 18,
+  FM_WALK         = 1 << 19,
+  FM_GREP         = 1 << 20,
+  FM_PANES        = 1 << 21,
+  FM_NAV_MSG      = 1 << 22,
+  FM_DU           = 1 << 23,
+  FM_DIRTY_SIZE   = 1 << 24,
+  FM_GREP_SET     = 1 << 25,
+  FM_DIRTY_WIDTH  = 1 << 26,
 };
 
+enum {
+  ENT_DIR       = 0,
+  ENT_LNK_DIR   = 1,
+  ENT_LNK       = 3,
+  ENT_LNK_BRK   = 5,
+  ENT_UNKNOWN   = 4,
+  ENT_FIFO      = 6,
+  ENT_SOCK      = 8,
+  ENT_SPEC      = 10,
+  ENT_REG       = 12,
+  ENT_REG_EXEC  = 14,
+  ENT_TYPE_MAX  = 16,
+};
+
+#define ENT_IS_LNK(t) ((t) & 1)
+#define ENT_IS_DIR(t) ((t) <= ENT_LNK_DIR)
+
+//
+// Sets of entry types for the type filter.
+//
+#define ENT_MASK_ALL  ((1u << ENT_TYPE_MAX) - 1)
+#define ENT_MASK_DIR  ((1u << ENT_DIR) | (1u << ENT_LNK_DIR))
+#define ENT_MASK_EXEC (1u << ENT_REG_EXEC)
+
 struct fm;
 typedef void (*fm_key_press)(struct fm *, int k, cut, cut);
 typedef  int (*fm_key_enter)(struct fm *, str *);
 typedef  int (*fm_filter)(struct fm *, usize, cut, cut);
+typedef  int (*fm_job_fn)(struct fm *, struct fs_prog *);
 
 struct fm {
   struct term t;
@@ -150,6 +192,39 @@ struct fm {
   str mpwd;
 
   str io;
+  struct iovec iv[DFM_IO_IOV];
+  usize il;
+  char ib[DFM_IO_IOV][DFM_IO_MAX];
+  str ro;
+  struct fm_row {
+    u32 o;
+    u32 h;
+    u16 c;
+    u16 l;
+    u8 v;
+    u8 f;
+  } rc[DFM_ROW_CACHE];
+  char rb[DFM_ROW_CACHE][DFM_ROW_CACHE_LEN];
+  u32 sh[DFM_ROW_MAX];
+  usize sy;
+  usize sc;
+  usize sg;
+  u64 fu;
+#ifdef DFM_STATS
+  struct {
+    u64 b;
+    u64 k;
+    u64 f;
+    u64 t;
+    u64 kt;
+    u64 l;
+    u64 lm;
+    u64 ln;
+    u64 w;
+    u64 fc;
+    u64 fm;
+  } sx;
+#endif
 
   usize ml;
   usize mp;
@@ -167,6 +242,7 @@ struct fm {
   u8 dv;
   u8 ds;
   u32 du;
+  u16 dw;
 
   u64 v[BITSET_W(DFM_DIR_MAX)];
   u16 vp[BITSET_W(DFM_DIR_MAX)];
@@ -179,8 +255,93 @@ struct fm {
   u64 vm[BITSET_W(DFM_DIR_MAX)];
   usize vml;
 
+  u64 vt[ENT_TYPE_MAX][BITSET_W(DFM_DIR_MAX)];
+  u64 vd[BITSET_W(DFM_DIR_MAX)];
+  u16 vf;
+
   u32 ht[DFM_DIR_HT_CAP];
 
+  struct walk w;
+  char fq[DFM_NAME_MAX];
+  char fi[DFM_FIND_IGNORE_MAX];
+  usize fil;
+  usize fo[WALK_DEPTH];
+  struct fm_find *fr;
+  usize frl;
+  usize fc;
+  usize fn;
+  pid_t fj;
+
+  u64 gc[BITSET_W(DFM_DIR_MAX)];
+  usize gi;
+  off_t go;
+  int gd;
+  char gb[DFM_GREP_WIN];
+
+  struct fm_pane {
+    u32 k;
+    int d;
+    u64 t;
+    usize n;
+    usize l;
+    usize sl;
+    struct timespec m;
+    char s[PATH_MAX + DFM_NAME_MAX + 1];
+    const char *e[DFM_PANE_ENT];
+    char b[DFM_PANE_MAX];
+  } pn[DFM_PANE_CACHE];
+  int pd;
+  pid_t pp;
+  usize pq;
+  usize pi;
+  u64 pt;
+  u32 pv[2];
+  u32 ph[2][DFM_ROW_MAX];
+  u16 px;
+  u16 lw;
+
+  struct fs_copy cp;
+  struct fs_rm rm;
+  struct trash tr;
+  struct fs_attr at;
+  struct journal jr;
+  struct fm_par {
+    pid_t pid;
+    usize i;
+    usize l;
+    char b[DFM_PAR_BUF];
+  } pr[DFM_PAR_MAX];
+  struct pollfd pf[DFM_PAR_MAX];
+  usize pj;
+  usize bn;
+  usize bm;
+  usize bb;
+  char *av[DFM_ARG_MAX];
+  struct fm_ren {
+    cut d;
+    u16 e;
+    u16 n;
+    u16 q;
+    bool x;
+  } rn[DFM_DIR_MAX];
+  u16 rx[DFM_DIR_MAX];
+  u32 rs[DFM_DIR_MAX * 2];
+  struct fm_job {
+    pid_t pid;
+    cut n;
+    fm_job_fn f;
+  } jb[DFM_JOB_MAX];
+  struct fs_prog *jg;
+  usize jn;
+  u64 jt;
+
+  struct fm_du *dr;
+  struct fm_du_ent *dc;
+  usize drl;
+  usize da;
+  pid_t dj;
+  u8 dz;
+
   usize y;
   usize o;
   usize c;
@@ -214,7 +375,7 @@ struct fm {
 #define ENT_V_CHAR 20,  8
 #define ENT_V_TOMB 28,  1
 #define ENT_V_MARK 29,  1
-#define ENT_V_VIS  30,  1
+#define ENT_V_ECHO 30,  1
 #define ENT_V_DOT  31,  1
 
 #define ent_v_get(e, o)     bitfield_get32((e),      ENT_V_##o)
@@ -251,23 +412,6 @@ ent_v_store(struct fm *p, usize i, u32 v)
 
 // Entry Physical {{{
 
-enum {
-  ENT_DIR       = 0,
-  ENT_LNK_DIR   = 1,
-  ENT_LNK       = 3,
-  ENT_LNK_BRK   = 5,
-  ENT_UNKNOWN   = 4,
-  ENT_FIFO      = 6,
-  ENT_SOCK      = 8,
-  ENT_SPEC      = 10,
-  ENT_REG       = 12,
-  ENT_REG_EXEC  = 14,
-  ENT_TYPE_MAX  = 16,
-};
-
-#define ENT_IS_LNK(t) ((t) & 1)
-#define ENT_IS_DIR(t) ((t) <= ENT_LNK_DIR)
-
 #define ENT_UTF8  0,  1
 #define ENT_CTRL  1,  1
 #define ENT_LOC   2, 16
@@ -304,6 +448,12 @@ ent_load_off(const struct fm *p, u32 o)
   return m;
 }
 
+static inline void
+ent_store_off(struct fm *p, u32 o, u64 m)
+{
+  memcpy(p->de + o - sizeof(m), &m, sizeof(m));
+}
+
 static inline void
 ent_perm_decode(str *s, mode_t m, u8 t)
 {
@@ -384,8 +534,9 @@ ent_size_decode(str *s, u32 v, usize p, u8 t)
   u32 u = e / 10;
   if (u > 6) u = 6;
   u64 b = 1ULL << (e - u * 10);
-  u64 ip = b + ((b * f) >> 6);
-  u32 d = ((f * 10) + 32) >> 6;
+  u64 x = (b << 6) + b * f;
+  u64 ip = x >> 6;
+  u32 d = (u32)(((x & 63) * 10) + 32) >> 6;
   if (d == 10) { ip++; d = 0; }
   int sd = (u && ip < 10);
   usize su = 1 + (sd ? 2 : 0);
@@ -565,37 +716,18 @@ ent_prev(struct fm *p, usize i)
 
 typedef int (*ent_sort_cb)(struct fm *, u32, u32);
 
+static const unsigned char FM_CMP_DIGIT[256] = {
+  ['0']=1,['1']=1,['2']=1,['3']=1,['4']=1,
+  ['5']=1,['6']=1,['7']=1,['8']=1,['9']=1
+};
+
+//
+// Compare names with runs of digits ordered by value.
+//
 static inline int
-fm_ent_cmp_name(struct fm *p, u32 a, u32 b)
+fm_cmp_natural(const char *pa, usize la, const char *pb, usize lb)
 {
-  static const unsigned char t[256] = {
-    ['0']=1,['1']=1,['2']=1,['3']=1,['4']=1,
-    ['5']=1,['6']=1,['7']=1,['8']=1,['9']=1
-  };
-
-  u32 oa = ent_v_get(a, OFF);
-  u32 ob = ent_v_get(b, OFF);
-  u64 ma = ent_load_off(p, oa);
-  u64 mb = ent_load_off(p, ob);
-
-  int r = ENT_IS_DIR(ent_get(mb, TYPE)) - ENT_IS_DIR(ent_get(ma, TYPE));
-  if (unlikely(r)) return r;
-
-  u8 fa = ent_v_get(a, CHAR);
-  u8 fb = ent_v_get(b, CHAR);
-
-  int da = (unsigned)(fa - '0') < 10;
-  int db = (unsigned)(fb - '0') < 10;
-  if (da ^ db)
-    return da ? -1 : 1;
-
-  if (fa != fb && !(t[fa] & t[fb]))
-    return fa < fb ? -1 : 1;
-
-  const char *pa = p->de + oa;
-  const char *pb = p->de + ob;
-  usize la = ent_get(ma, LEN);
-  usize lb = ent_get(mb, LEN);
+  const unsigned char *t = FM_CMP_DIGIT;
   usize i = 0;
   usize j = 0;
 
@@ -633,6 +765,34 @@ fm_ent_cmp_name(struct fm *p, u32 a, u32 b)
   return (i < la) - (j < lb);
 }
 
+static inline int
+fm_ent_cmp_name(struct fm *p, u32 a, u32 b)
+{
+  const unsigned char *t = FM_CMP_DIGIT;
+
+  u32 oa = ent_v_get(a, OFF);
+  u32 ob = ent_v_get(b, OFF);
+  u64 ma = ent_load_off(p, oa);
+  u64 mb = ent_load_off(p, ob);
+
+  int r = ENT_IS_DIR(ent_get(mb, TYPE)) - ENT_IS_DIR(ent_get(ma, TYPE));
+  if (unlikely(r)) return r;
+
+  u8 fa = ent_v_get(a, CHAR);
+  u8 fb = ent_v_get(b, CHAR);
+
+  int da = (unsigned)(fa - '0') < 10;
+  int db = (unsigned)(fb - '0') < 10;
+  if (da ^ db)
+    return da ? -1 : 1;
+
+  if (fa != fb && !(t[fa] & t[fb]))
+    return fa < fb ? -1 : 1;
+
+  return fm_cmp_natural(p->de + oa, ent_get(ma, LEN),
+                        p->de + ob, ent_get(mb, LEN));
+}
+
 static inline int
 fm_ent_cmp_name_rev(struct fm *p, u32 a, u32 b)
 {
@@ -644,9 +804,9 @@ fm_ent_cmp_size(struct fm *p, u32 a, u32 b)
 {
   u64 ma = ent_load_off(p, ent_v_get(a, OFF));
   u64 mb = ent_load_off(p, ent_v_get(b, OFF));
-  u32 sa = ent_size_bytes(ent_get(ma, SIZE), ent_get(ma, TYPE));
-  u32 sb = ent_size_bytes(ent_get(mb, SIZE), ent_get(mb, TYPE));
-  return (size)sa - (size)sb;
+  u64 sa = ent_size_bytes(ent_get(ma, SIZE), ent_get(ma, TYPE));
+  u64 sb = ent_size_bytes(ent_get(mb, SIZE), ent_get(mb, TYPE));
+  return (sa > sb) - (sa < sb);
 }
 
 static inline int
@@ -760,6 +920,14 @@ fm_sort_fn(u8 s)
 
 // Util {{{
 
+static inline u64
+fm_clock(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (u64)t.tv_sec * 1000000 + (u64)t.tv_nsec / 1000;
+}
+
 static inline cut
 fm_ent(const struct fm *p, usize i)
 {
@@ -830,43 +998,95 @@ next_tok(const char *s, usize l, usize *c, cut *o)
 
 // Visibility {{{
 
-static inline void
-fm_v_clr(struct fm *p, usize i)
+//
+// The visibility bitset is the only record of which entries are shown. The
+// rank of each word (visible entries before it) is kept in vp.
+//
+
+static inline u8
+fm_v_get(const struct fm *p, usize i)
 {
-  if (!ent_v_geto(p, i, VIS)) return;
-  u32 e = ent_v_load(p, i);
-  ent_v_set(&e, VIS, 0);
-  ent_v_store(p, i, e);
+  return bitset_get(p->v, i);
 }
 
+//
+// Set or clear a single entry, shifting the ranks of the words after it.
+//
 static inline void
 fm_v_assign(struct fm *p, usize i, u8 v)
 {
-  if (ent_v_geto(p, i, VIS) == v)
+  if (fm_v_get(p, i) == v)
     return;
-  u32 e = ent_v_load(p, i);
-  ent_v_set(&e, VIS, v);
-  ent_v_store(p, i, e);
+  bitset_assign(p->v, i, v);
+  u16 d = v ? 1 : (u16)-1;
+  for (usize b = (i >> 6) + 1, c = BITSET_W(p->dl); b < c; b++)
+    p->vp[b] += d;
+  p->vl += v ? 1 : -1;
 }
 
+//
+// Prefix sum of the word popcounts, four words per step so the popcounts
+// are independent of each other.
+//
 static inline void
 fm_v_rebuild(struct fm *p)
 {
-  p->vl = 0;
+  usize c = BITSET_W(p->dl);
+  usize b = 0;
   u16 s = 0;
-  for (usize b = 0, c = BITSET_W(p->dl); b < c; b++) {
-    u64 w = 0;
-    for (usize j = 0; j < 64; j++) {
-      usize i = (b << 6) + j;
-      if (i >= p->dl) break;
-      if (ent_v_geto(p, i, VIS))
-        w |= 1ULL << j;
-    }
-    p->v[b] = w;
+  for (; b + 4 <= c; b += 4) {
+    u16 a0 = u64_popcount(p->v[b + 0]);
+    u16 a1 = u64_popcount(p->v[b + 1]);
+    u16 a2 = u64_popcount(p->v[b + 2]);
+    u16 a3 = u64_popcount(p->v[b + 3]);
+    p->vp[b + 0] = s;
+    p->vp[b + 1] = s + a0;
+    p->vp[b + 2] = s + a0 + a1;
+    p->vp[b + 3] = s + a0 + a1 + a2;
+    s += a0 + a1 + a2 + a3;
+  }
+  for (; b < c; b++) {
     p->vp[b] = s;
-    s += u64_popcount(w);
+    s += u64_popcount(p->v[b]);
   }
   p->vl = s;
+  p->f |= FM_DIRTY_WIDTH;
+}
+
+//
+// Entries allowed by the type filter and the hidden toggle.
+//
+static inline u64
+fm_v_base(const struct fm *p, usize b)
+{
+  u64 w = 0;
+  for (u32 t = p->vf; t; t &= t - 1)
+    w |= p->vt[u64_ctz(t)][b];
+  return p->f & FM_HIDDEN ? w : w & ~p->vd[b];
+}
+
+static inline void
+fm_v_attr_set(struct fm *p, usize i, u8 t, int d)
+{
+  bitset_set(p->vt[t], i);
+  bitset_assign(p->vd, i, d);
+}
+
+static inline void
+fm_v_attr_clr(struct fm *p, usize i, u8 t)
+{
+  bitset_clr(p->vt[t], i);
+  bitset_clr(p->vd, i);
+}
+
+static inline void
+fm_v_attr_clear(struct fm *p)
+{
+  usize n = BITSET_W(p->dl) * sizeof(u64);
+  for (usize t = 0; t < ENT_TYPE_MAX; t++)
+    memset(p->vt[t], 0, n);
+  memset(p->vd, 0, n);
+  memset(p->v, 0, n);
 }
 
 // }}}
@@ -882,14 +1102,57 @@ fm_filter_pct_rank(struct fm *p, usize idx)
   return (usize)p->vp[b] + u64_popcount(p->v[b] & m);
 }
 
+static int
+fm_filter_hidden(struct fm *p, usize i, cut cl, cut cr)
+{
+  (void)cl;
+  (void)cr;
+  return (fm_v_base(p, i >> 6) >> (i & 63)) & 1;
+}
+
+//
+// The base set is computed a word at a time from the attribute bitsets and
+// search filters are only called for the entries it leaves set.
+//
+static inline void
+fm_filter_word(struct fm *p, usize b, u64 w, fm_filter f, cut cl, cut cr)
+{
+  if (f != fm_filter_hidden)
+    for (u64 t = w; t; t &= t - 1) {
+      usize j = u64_ctz(t);
+      if (!f(p, (b << 6) + j, cl, cr)) w &= ~(1ULL << j);
+    }
+  p->v[b] = w;
+}
+
+//
+// Width of the widest visible name. Only the grid view needs it, so it is
+// marked stale whenever visibility changes and worked out again the next
+// time a grid cell is measured.
+//
+static inline void
+fm_v_width(struct fm *p)
+{
+  usize w = 0;
+  for (usize b = 0, c = BITSET_W(p->dl); b < c; b++)
+    for (u64 t = p->v[b]; t; t &= t - 1) {
+      usize i = (b << 6) + u64_ctz(t);
+      u64 m = ent_load(p, i);
+      usize l = ent_get(m, LEN);
+      usize lw;
+      if (ent_get(m, UTF8)) l = utf8_cols(fm_ent(p, i).d, l, &lw);
+      if (l > w) w = l;
+    }
+  p->dw = (u16) w;
+  p->f &= ~FM_DIRTY_WIDTH;
+}
+
 static inline void
 fm_filter_apply(struct fm *p, fm_filter f, cut cl, cut cr)
 {
-  for (usize i = 0; i < p->dl; i++)
-    if (ent_v_geto(p, i, TOMB))
-      fm_v_clr(p, i);
-    else
-      fm_v_assign(p, i, f(p, i, cl, cr));
+  p->f &= ~FM_GREP;
+  for (usize b = 0, c = BITSET_W(p->dl); b < c; b++)
+    fm_filter_word(p, b, fm_v_base(p, b), f, cl, cr);
   fm_v_rebuild(p);
   p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
@@ -897,25 +1160,12 @@ fm_filter_apply(struct fm *p, fm_filter f, cut cl, cut cr)
 static inline void
 fm_filter_apply_inc(struct fm *p, fm_filter f, cut cl, cut cr)
 {
-  for (usize i = ent_next(p, 0); i != SIZE_MAX; i = ent_next(p, i + 1))
-    if (ent_v_geto(p, i, TOMB) || !f(p, i, cl, cr))
-      fm_v_clr(p, i);
+  for (usize b = 0, c = BITSET_W(p->dl); b < c; b++)
+    if (p->v[b]) fm_filter_word(p, b, p->v[b] & fm_v_base(p, b), f, cl, cr);
   fm_v_rebuild(p);
   p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
-static int
-fm_filter_hidden(struct fm *p, usize i, cut cl, cut cr)
-{
-  (void)cl;
-  (void)cr;
-  if (ent_v_geto(p, i, TOMB))
-    return 0;
-  if (p->f & FM_HIDDEN)
-    return 1;
-  return !ent_v_geto(p, i, DOT);
-}
-
 static inline int
 fm_filter_startswith(struct fm *p, usize i, cut cl, cut cr)
 {
@@ -954,6 +1204,18 @@ fm_filter_substr(struct fm *p, usize i, cut cl, cut cr)
   return 0;
 }
 
+//
+// Entries a content search matched, kept in the grep bitset once the scan is
+// over so the result survives the listing being sorted again.
+//
+static int
+fm_filter_grep(struct fm *p, usize i, cut cl, cut cr)
+{
+  (void) cl;
+  (void) cr;
+  return bitset_get(p->gc, i);
+}
+
 //
 // TODO: Make this incremental.
 //
@@ -984,7 +1246,7 @@ fm_filter_clear(struct fm *p)
   fm_filter_apply(p, fm_filter_hidden, CUT_NULL, CUT_NULL);
   p->vql = 0;
   p->vqw = 0;
-  p->f &= ~FM_SEARCH;
+  p->f &= ~(FM_SEARCH|FM_GREP_SET);
 }
 
 static inline usize
@@ -1170,130 +1432,635 @@ fm_dir_ht_clear(struct fm *p)
 
 // }}}
 
-// Draw {{{
+// Panes {{{
 
-static inline void
-fm_draw_flush(struct fm *p)
+//
+// Miller columns show the parent directory left of the list and the
+// directory under the cursor right of it. Their listings go into a small
+// cache keyed by path. Each is read by a forked child which sorts it and
+// writes it back through a pipe that fm_update() drains without blocking,
+// and a read is abandoned as soon as the cursor moves elsewhere, so neither
+// large nor slow directories ever hold up input. Only PWD is watched, so a
+// cached pane is checked against the modification time of its directory
+// whenever it comes back into view.
+//
+static inline int
+fm_panes(const struct fm *p)
 {
-  STR_PUSH(&p->io, VT_ESU);
-  p->io.f(&p->io, p, 0);
-  STR_PUSH(&p->io, VT_BSU);
+  return p->lw < p->col;
 }
 
 static inline void
-fm_draw_name_tail(str *s, const char *n, usize l, usize dr, int utf8, int ctrl)
+fm_pane_layout(struct fm *p)
 {
-  usize mtc = dr > DFM_TRUNC_WIDTH ? dr - DFM_TRUNC_WIDTH : 0;
-  usize c = MIN(mtc, DFM_TRUNC_LEN);
-  usize tc = 0;
-  usize t = l;
-  if (utf8) {
-    while (t > 0 && tc < c) {
-      usize pr = t - 1;
-      while (pr > 0 && (n[pr] & 0xC0) == 0x80) pr--;
-      u32 cp;
-      int e;
-      utf8_decode_untrusted((void *)(n + pr), &cp, &e);
-      usize w = e ? 1 : utf8_width(cp);
-      if (tc + w > c) break;
-      tc += w;
-      t = e ? t - 1 : pr;
-    }
-  } else {
-    tc = MIN(l, c);
-    t = l - tc;
-  }
-  if (dr <= tc + tc + DFM_TRUNC_WIDTH) return;
-  vt_cub(s, tc + DFM_TRUNC_WIDTH + 1);
-  STR_PUSH(s, DFM_TRUNC_STR);
-  str_push_q(s, n + t, l - t, ctrl);
+  p->px = 0;
+  p->lw = p->col;
+  if (!(p->f & FM_PANES) || p->col < DFM_PANE_MIN) return;
+  p->px = (u16)(p->col * DFM_PANE_PARENT / 100);
+  p->lw = (u16)(p->col - p->px - p->col * DFM_PANE_CHILD / 100);
 }
 
-static inline usize
-fm_draw_name_ellipsis(struct fm *p, u64 m, const char *n, usize l, usize c)
+static inline u32
+fm_pane_hash(u32 h, const char *s, usize l)
 {
-  if (c < 2) return 0;
-  c--;
-  int ct = ent_get(m, CTRL);
-  if (!ent_get(m, UTF8)) {
-    usize d = MIN(l, c);
-    str_push_q(&p->io, n, d, ct);
-    if (l > d) fm_draw_name_tail(&p->io, n, l, d + 1, 0, ct);
-    return d;
-  }
-  usize dr;
-  usize tl = fm_cache_trunc_utf8(p, n, l, c, &dr);
-  str_push_q(&p->io, n, tl, ct);
-  if (tl < l) fm_draw_name_tail(&p->io, n, l, dr, 1, ct);
-  return dr;
+  for (usize i = 0; i < l; i++)
+    h = (h ^ (u8)s[i]) * 16777619u;
+  return h;
 }
 
-static inline void
-fm_draw_ent(struct fm *p, usize n)
+//
+// A pane is keyed by its path, given in three parts so the child's need not
+// be put together, and by a hash of it which is 0 when there is no pane.
+//
+static inline u32
+fm_pane_key(const cut *k)
 {
-  u64 e = ent_load(p, n);
-  u32 o = ent_v_geto(p, n, OFF);
-  u32 t = ent_get(e, TYPE);
-  s32 vw = p->col;
+  u32 h = 2166136261u;
+  for (usize i = 0; i < 3; i++) h = fm_pane_hash(h, k[i].d, k[i].l);
+  return h | 1;
+}
 
-  switch (p->dv) {
-  case 's': vw -=  7; ent_size_decode(&p->io, ent_get(e, SIZE), 6, t); break;
-  case 'p': vw -= 11; ent_perm_decode(&p->io, ent_get(e, PERM), t); break;
-  case 't': vw -=  8; ent_time_decode(&p->io, ent_get(e, TIME)); break;
-  case 'a':
-    vw -= 26;
-    ent_perm_decode(&p->io, ent_get(e, PERM), t);
-    ent_time_decode(&p->io, ent_get(e, TIME));
-    ent_size_decode(&p->io, ent_get(e, SIZE), 6, t);
-    break;
-  }
+static inline u32
+fm_pane_key_parent(const struct fm *p, cut *k)
+{
+  usize i = p->pwd.l;
+  while (i > 0 && p->pwd.m[i - 1] != '/') i--;
+  if (p->pwd.l <= 1) return 0;
+  k[0] = (cut){ p->pwd.m, i > 1 ? i - 1 : 1 };
+  k[1] = k[2] = CUT_NULL;
+  return fm_pane_key(k);
+}
 
-  switch (t) {
-  case ENT_DIR:      STR_PUSH(&p->io, DFM_COL_DIR);      vw--; break;
-  case ENT_FIFO:     STR_PUSH(&p->io, DFM_COL_FIFO);     break;
-  case ENT_LNK:      STR_PUSH(&p->io, DFM_COL_LNK);      break;
-  case ENT_LNK_BRK:  STR_PUSH(&p->io, DFM_COL_LNK_BRK);  break;
-  case ENT_LNK_DIR:  STR_PUSH(&p->io, DFM_COL_LNK_DIR);  break;
-  case ENT_REG_EXEC: STR_PUSH(&p->io, DFM_COL_REG_EXEC); vw--; break;
-  case ENT_SOCK:     STR_PUSH(&p->io, DFM_COL_SOCK);     break;
-  case ENT_SPEC:     STR_PUSH(&p->io, DFM_COL_SPEC);     break;
-  case ENT_UNKNOWN:  STR_PUSH(&p->io, DFM_COL_UNKNOWN);  break;
-  }
-
-  int m = p->f & FM_MARK_PWD && p->vml && ent_v_geto(p, n, MARK);
-  if (m) {
-    STR_PUSH(&p->io, DFM_COL_MARK " ");
-    vw -= 2;
-  }
-  if (p->c == n) STR_PUSH(&p->io, DFM_COL_CURSOR);
-  usize l = ent_get(e, LEN);
-  const char *dn = &p->de[o];
-  vw -= fm_draw_name_ellipsis(p, e, dn, l, vw);
+static inline u32
+fm_pane_key_name(const struct fm *p, cut n, cut *k)
+{
+  k[0] = (cut){ p->pwd.m, p->pwd.l };
+  k[1] = p->pwd.l > 1 ? CUT("/") : CUT_NULL;
+  k[2] = n;
+  return fm_pane_key(k);
+}
 
-  switch (t) {
-  case ENT_LNK_DIR:
-  case ENT_DIR:      str_push_c(&p->io, '/'); break;
-  case ENT_REG_EXEC: str_push_c(&p->io, '*'); break;
+static inline u32
+fm_pane_key_child(const struct fm *p, cut *k)
+{
+  if (p->c == SIZE_MAX || !p->vl) return 0;
+  if (!ENT_IS_DIR(ent_get(ent_load(p, p->c), TYPE))) return 0;
+  return fm_pane_key_name(p, fm_ent(p, p->c), k);
+}
+
+static inline int
+fm_pane_is(const struct fm_pane *n, u32 h, const cut *k)
+{
+  if (!h || n->k != h) return 0;
+  usize o = 0;
+  for (usize i = 0; i < 3; i++) {
+    if (k[i].l > n->sl - o || memcmp(n->s + o, k[i].d, k[i].l)) return 0;
+    o += k[i].l;
   }
+  return o == n->sl;
+}
 
-  if (m) str_push_c(&p->io, '*');
+static inline struct fm_pane *
+fm_pane_find(struct fm *p, u32 h, const cut *k)
+{
+  if (!h) return NULL;
+  for (usize i = 0; i < DFM_PANE_CACHE; i++)
+    if (fm_pane_is(&p->pn[i], h, k)) return &p->pn[i];
+  return NULL;
+}
 
-  if (ENT_IS_LNK(t)) {
-    u8 sl = ent_get(e, SIZE);
+static inline struct fm_pane *
+fm_pane_get(struct fm *p, u32 h, const cut *k)
+{
+  struct fm_pane *n = fm_pane_find(p, h, k);
+  if (!n || !n->d) return NULL;
+  n->t = ++p->pt;
+  return n;
+}
+
+static inline void
+fm_pane_cancel(struct fm *p)
+{
+  if (p->pd < 0) return;
+  close(p->pd);
+  kill(p->pp, SIGKILL);
+  p->pd = -1;
+  p->pp = 0;
+  p->pn[p->pi].k = 0;
+}
+
+static inline void
+fm_pane_clear(struct fm *p)
+{
+  fm_pane_cancel(p);
+  for (usize i = 0; i < DFM_PANE_CACHE; i++)
+    p->pn[i].k = 0;
+}
+
+//
+// Forget the listing of the directory n in PWD after an event for it.
+//
+static inline void
+fm_pane_drop(struct fm *p, cut n)
+{
+  cut k[3];
+  struct fm_pane *x = fm_pane_find(p, fm_pane_key_name(p, n, k), k);
+  if (!x) return;
+  if (p->pd >= 0 && x == &p->pn[p->pi]) fm_pane_cancel(p);
+  x->k = 0;
+}
+
+static inline void
+fm_pane_check(struct fm *p, u32 h, const cut *k, const char *s)
+{
+  struct fm_pane *n = fm_pane_find(p, h, k);
+  struct stat st;
+  if (!n || !n->d) return;
+  if (fstatat(p->dfd, s, &st, 0) == 0 &&
+      st.FS_MTIM.tv_sec == n->m.tv_sec && st.FS_MTIM.tv_nsec == n->m.tv_nsec)
+    return;
+  n->k = 0;
+}
+
+static inline int
+fm_pane_cmp(const void *a, const void *b)
+{
+  const char *x = *(const char *const *)a;
+  const char *y = *(const char *const *)b;
+  int r = ENT_IS_DIR((u8)y[-1]) - ENT_IS_DIR((u8)x[-1]);
+  if (r) return r;
+  return fm_cmp_natural(x, strlen(x), y, strlen(y));
+}
+
+static inline int
+fm_pane_add(struct fm_pane *n, int fd, const struct dirent *e)
+{
+  const char *s = e->d_name;
+  if (s[0] == '.' && (!s[1] || (s[1] == '.' && !s[2]))) return 0;
+  usize l = strlen(s);
+  if (n->n >= DFM_PANE_ENT || n->l + l + 2 > DFM_PANE_MAX) return -1;
+  struct stat st;
+  u8 t;
+  switch (walk_type(e)) {
+  case WALK_T_DIR:   t = ENT_DIR;  break;
+  case WALK_T_LNK:   t = ENT_LNK;  break;
+  case WALK_T_REG:   t = ENT_REG;  break;
+  case WALK_T_OTHER: t = ENT_SPEC; break;
+  default:
+    if (fstatat(fd, s, &st, AT_SYMLINK_NOFOLLOW) == -1)
+      t = ENT_UNKNOWN;
+    else
+      t = S_ISDIR(st.st_mode) ? ENT_DIR : S_ISLNK(st.st_mode) ? ENT_LNK : ENT_REG;
+  }
+  n->b[n->l] = (char)t;
+  memcpy(n->b + n->l + 1, s, l + 1);
+  n->e[n->n++] = n->b + n->l + 1;
+  n->l += l + 2;
+  return 0;
+}
+
+//
+// Runs in the child. The modification time of the directory goes first,
+// then each entry as its type and NUL terminated name in sorted order.
+//
+static inline void
+fm_pane_list(struct fm *p, struct fm_pane *n, int o, const char *s)
+{
+  int fd = openat(p->dfd, s, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  DIR *d = fd < 0 ? NULL : fdopendir(fd);
+  struct stat st;
+  if (!d || fstat(fd, &st) < 0) _exit(1);
+  write_all(o, (const char *)&st.FS_MTIM, sizeof(st.FS_MTIM));
+  for (struct dirent *e; (e = readdir(d)) && !fm_pane_add(n, fd, e); );
+  qsort(n->e, n->n, sizeof(*n->e), fm_pane_cmp);
+  char b[4096];
+  usize l = 0;
+  for (usize i = 0; i < n->n; i++) {
+    usize el = strlen(n->e[i]) + 2;
+    if (l + el > sizeof(b)) {
+      write_all(o, b, l);
+      l = 0;
+    }
+    memcpy(b + l, n->e[i] - 1, el);
+    l += el;
+  }
+  write_all(o, b, l);
+  _exit(0);
+}
+
+static inline void
+fm_pane_done(struct fm *p)
+{
+  if (p->pd >= 0) close(p->pd);
+  p->pd = -1;
+  p->pp = 0;
+  p->pn[p->pi].d = 1;
+  p->f |= FM_REDRAW_DIR;
+}
+
+static inline void
+fm_pane_start(struct fm *p, u32 h, const cut *k, const char *s)
+{
+  usize j = 0;
+  for (usize i = 1; i < DFM_PANE_CACHE; i++)
+    if (p->pn[i].t < p->pn[j].t) j = i;
+  struct fm_pane *n = &p->pn[j];
+  n->sl = 0;
+  for (usize i = 0; i < 3; i++) {
+    if (k[i].l) memcpy(n->s + n->sl, k[i].d, k[i].l);
+    n->sl += k[i].l;
+  }
+  n->k = h;
+  n->d = 0;
+  n->t = ++p->pt;
+  n->n = 0;
+  n->l = 0;
+  n->m = (struct timespec){0};
+  p->pi = j;
+  p->pq = 0;
+  int fd[2];
+  if (pipe(fd) < 0) {
+    fm_pane_done(p);
+    return;
+  }
+  pid_t pid = fork();
+  if (!pid) {
+    term_signal_child();
+    close(fd[0]);
+    fm_pane_list(p, n, fd[1], s);
+  }
+  close(fd[1]);
+  if (pid < 0) {
+    close(fd[0]);
+    fm_pane_done(p);
+    return;
+  }
+  fcntl(fd[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fd[0], F_SETFL, O_NONBLOCK);
+  p->pd = fd[0];
+  p->pp = pid;
+}
+
+//
+// Take whatever the child wrote so far. Returns 1 after reading something,
+// -1 when there is nothing yet and 0 once the listing is complete.
+//
+static inline int
+fm_pane_read(struct fm *p, struct fm_pane *n)
+{
+  usize h = sizeof(n->m);
+  usize o = p->pq > h ? p->pq - h : 0;
+  char *d = p->pq < h ? (char *)&n->m + p->pq : n->b + o;
+  usize c = p->pq < h ? h - p->pq : DFM_PANE_MAX - o;
+  if (!c) return 0;
+  ssize_t r = read(p->pd, d, c);
+  if (r < 0) return errno == EAGAIN || errno == EINTR ? -1 : 0;
+  if (!r) return 0;
+  p->pq += (usize) r;
+  o = p->pq > h ? p->pq - h : 0;
+  while (n->l + 1 < o && n->n < DFM_PANE_ENT) {
+    char *z = memchr(n->b + n->l + 1, 0, o - n->l - 1);
+    if (!z) break;
+    n->e[n->n++] = n->b + n->l + 1;
+    n->l = (usize)(z - n->b) + 1;
+  }
+  return 1;
+}
+
+static inline void
+fm_pane_step(struct fm *p)
+{
+  cut ap[3];
+  cut ac[3];
+  u32 kp = fm_pane_key_parent(p, ap);
+  u32 kc = fm_pane_key_child(p, ac);
+  if (p->pd >= 0 && !fm_pane_is(&p->pn[p->pi], kp, ap) &&
+      !fm_pane_is(&p->pn[p->pi], kc, ac))
+    fm_pane_cancel(p);
+  if (kp != p->pv[0]) fm_pane_check(p, kp, ap, "..");
+  if (kc && kc != p->pv[1]) fm_pane_check(p, kc, ac, fm_ent(p, p->c).d);
+  p->pv[0] = kp;
+  p->pv[1] = kc;
+  for (usize i = 0; i < DFM_PANE_STEP; i++) {
+    if (p->pd < 0) {
+      if (kp && !fm_pane_find(p, kp, ap))
+        fm_pane_start(p, kp, ap, "..");
+      else if (kc && !fm_pane_find(p, kc, ac))
+        fm_pane_start(p, kc, ac, fm_ent(p, p->c).d);
+      if (p->pd < 0) return;
+    }
+    int r = fm_pane_read(p, &p->pn[p->pi]);
+    if (r < 0) return;
+    if (!r) fm_pane_done(p);
+  }
+}
+
+// }}}
+
+// Draw {{{
+
+//
+// Grid view cells fit the widest name in the directory plus a type suffix,
+// a mark and a gap.
+//
+static inline usize
+fm_grid_w(struct fm *p)
+{
+  if (p->f & FM_DIRTY_WIDTH) fm_v_width(p);
+  usize c = MAX(p->lw, 4);
+  return MIN(MAX(p->dw, 1), c - 3) + 3;
+}
+
+static inline usize
+fm_grid(struct fm *p)
+{
+  if (p->dv != 'g') return 1;
+  return MAX(p->lw / fm_grid_w(p), 1);
+}
+
+static inline void
+fm_draw_flush(struct fm *p)
+{
+  STR_PUSH(&p->io, VT_ESU);
+  p->io.f(&p->io, p, 0);
+  STR_PUSH(&p->io, VT_BSU);
+}
+
+static inline void
+fm_draw_name_tail(str *s, const char *n, usize l, usize dr, int utf8, int ctrl)
+{
+  usize mtc = dr > DFM_TRUNC_WIDTH ? dr - DFM_TRUNC_WIDTH : 0;
+  usize c = MIN(mtc, DFM_TRUNC_LEN);
+  usize tc = 0;
+  usize t = l;
+  if (utf8) {
+    while (t > 0 && tc < c) {
+      usize pr = t - 1;
+      while (pr > 0 && (n[pr] & 0xC0) == 0x80) pr--;
+      u32 cp;
+      int e;
+      utf8_decode_untrusted((void *)(n + pr), &cp, &e);
+      usize w = e ? 1 : utf8_width(cp);
+      if (tc + w > c) break;
+      tc += w;
+      t = e ? t - 1 : pr;
+    }
+  } else {
+    tc = MIN(l, c);
+    t = l - tc;
+  }
+  if (dr <= tc + tc + DFM_TRUNC_WIDTH) return;
+  vt_cub(s, tc + DFM_TRUNC_WIDTH + 1);
+  STR_PUSH(s, DFM_TRUNC_STR);
+  str_push_q(s, n + t, l - t, ctrl);
+}
+
+static inline usize
+fm_draw_name_ellipsis(struct fm *p, str *s, u64 m, const char *n, usize l, usize c)
+{
+  if (c < 2) return 0;
+  c--;
+  int ct = ent_get(m, CTRL);
+  if (!ent_get(m, UTF8)) {
+    usize d = MIN(l, c);
+    str_push_q(s, n, d, ct);
+    if (l > d) fm_draw_name_tail(s, n, l, d + 1, 0, ct);
+    return d;
+  }
+  usize dr;
+  usize tl = fm_cache_trunc_utf8(p, n, l, c, &dr);
+  str_push_q(s, n, tl, ct);
+  if (tl < l) fm_draw_name_tail(s, n, l, dr, 1, ct);
+  return dr;
+}
+
+static inline int
+fm_draw_ent_col(str *s, u32 t)
+{
+  switch (t) {
+  case ENT_DIR:      STR_PUSH(s, DFM_COL_DIR);      return 1;
+  case ENT_FIFO:     STR_PUSH(s, DFM_COL_FIFO);     break;
+  case ENT_LNK:      STR_PUSH(s, DFM_COL_LNK);      break;
+  case ENT_LNK_BRK:  STR_PUSH(s, DFM_COL_LNK_BRK);  break;
+  case ENT_LNK_DIR:  STR_PUSH(s, DFM_COL_LNK_DIR);  break;
+  case ENT_REG_EXEC: STR_PUSH(s, DFM_COL_REG_EXEC); return 1;
+  case ENT_SOCK:     STR_PUSH(s, DFM_COL_SOCK);     break;
+  case ENT_SPEC:     STR_PUSH(s, DFM_COL_SPEC);     break;
+  case ENT_UNKNOWN:  STR_PUSH(s, DFM_COL_UNKNOWN);  break;
+  }
+  return 0;
+}
+
+static inline int
+fm_draw_ent_mark(const struct fm *p, usize n)
+{
+  return p->f & FM_MARK_PWD && p->vml && ent_v_geto(p, n, MARK);
+}
+
+static inline void
+fm_draw_ent(struct fm *p, str *s, usize n)
+{
+  u64 e = ent_load(p, n);
+  u32 o = ent_v_geto(p, n, OFF);
+  u32 t = ent_get(e, TYPE);
+  s32 vw = p->lw;
+
+  switch (p->dv) {
+  case 's': vw -=  7; ent_size_decode(s, ent_get(e, SIZE), 6, t); break;
+  case 'p': vw -= 11; ent_perm_decode(s, ent_get(e, PERM), t); break;
+  case 't': vw -=  8; ent_time_decode(s, ent_get(e, TIME)); break;
+  case 'a':
+    vw -= 26;
+    ent_perm_decode(s, ent_get(e, PERM), t);
+    ent_time_decode(s, ent_get(e, TIME));
+    ent_size_decode(s, ent_get(e, SIZE), 6, t);
+    break;
+  }
+
+  vw -= fm_draw_ent_col(s, t);
+
+  int m = fm_draw_ent_mark(p, n);
+  if (m) {
+    STR_PUSH(s, DFM_COL_MARK " ");
+    vw -= 2;
+  }
+  if (p->c == n) STR_PUSH(s, DFM_COL_CURSOR);
+  usize l = ent_get(e, LEN);
+  const char *dn = &p->de[o];
+  vw -= fm_draw_name_ellipsis(p, s, e, dn, l, vw);
+
+  switch (t) {
+  case ENT_LNK_DIR:
+  case ENT_DIR:      str_push_c(s, '/'); break;
+  case ENT_REG_EXEC: str_push_c(s, '*'); break;
+  }
+
+  if (m) str_push_c(s, '*');
+
+  if (ENT_IS_LNK(t)) {
+    u8 sl = ent_get(e, SIZE);
     vw -= 4;
     if (vw <= 16) goto e;
-    STR_PUSH(&p->io, VT_SGR0 " -> ");
+    STR_PUSH(s, VT_SGR0 " -> ");
     if (sl) {
       dn = &p->de[o + l + 2];
       vw = fm_cache_trunc(p, dn[-1], dn, sl, vw);
       int ct = ent_get(dn[-1], CTRL);
-      str_push_q(&p->io, dn, vw, ct);
+      str_push_q(s, dn, vw, ct);
     } else
-      str_push_c(&p->io, '?');
+      str_push_c(s, '?');
   }
 
 e:
-  STR_PUSH(&p->io, VT_SGR0 VT_EL0 VT_CR);
+  STR_PUSH(s, VT_SGR0 VT_EL0 VT_CR);
+}
+
+//
+// A grid view cell is the name followed by its type suffix and mark, padded
+// to the cell width.
+//
+static inline void
+fm_draw_cell(struct fm *p, str *s, usize n)
+{
+  u64 e = ent_load(p, n);
+  u32 t = ent_get(e, TYPE);
+  usize w = fm_grid_w(p);
+  fm_draw_ent_col(s, t);
+  int m = fm_draw_ent_mark(p, n);
+  if (m) STR_PUSH(s, DFM_COL_MARK);
+  if (p->c == n) STR_PUSH(s, DFM_COL_CURSOR);
+  const char *dn = &p->de[ent_v_geto(p, n, OFF)];
+  usize x = fm_draw_name_ellipsis(p, s, e, dn, ent_get(e, LEN), w - 2);
+  switch (t) {
+  case ENT_LNK_DIR:
+  case ENT_DIR:      str_push_c(s, '/'); x++; break;
+  case ENT_REG_EXEC: str_push_c(s, '*'); x++; break;
+  }
+  if (m) {
+    str_push_c(s, '*');
+    x++;
+  }
+  STR_PUSH(s, VT_SGR0);
+  str_memset(s, ' ', w - x);
+}
+
+//
+// Rendered rows are cached by name offset, which is unique within a load,
+// along with everything else that changes their bytes. Entries updated by
+// filesystem events are reloaded at a new offset and their slots dropped.
+//
+static inline usize
+fm_row_slot(u32 o, u8 f)
+{
+  return ((o * 0x9E3779B1u) >> 16 ^ f) & (DFM_ROW_CACHE - 1);
+}
+
+static inline void
+fm_row_clear(struct fm *p)
+{
+  memset(p->rc, 0, sizeof(p->rc));
+}
+
+static inline void
+fm_row_drop(struct fm *p, u32 o)
+{
+  for (u8 f = 1; f < 8; f += 2)
+    p->rc[fm_row_slot(o, f)].f = 0;
+}
+
+//
+// Rows are rendered into a scratch buffer and hashed. The shadow screen holds
+// the hash of what each row on the terminal currently shows so unchanged rows
+// can be skipped. A zero hash marks a row as unknown.
+//
+static inline u32
+fm_draw_row(struct fm *p, usize n, cut *b)
+{
+  u32 o = ent_v_geto(p, n, OFF);
+  u8 f = 1 | (p->c == n) << 1 | fm_draw_ent_mark(p, n) << 2;
+  u16 w = p->dv == 'g' ? (u16)fm_grid_w(p) : p->lw;
+  usize i = fm_row_slot(o, f);
+  struct fm_row *r = &p->rc[i];
+  if (r->f == f && r->o == o && r->v == p->dv && r->c == w) {
+    *b = (cut){ p->rb[i], r->l };
+    return r->h;
+  }
+  p->ro.l = 0;
+  if (p->dv == 'g') fm_draw_cell(p, &p->ro, n);
+  else fm_draw_ent(p, &p->ro, n);
+  u32 h = hash_fnv1a32(p->ro.m, p->ro.l);
+  *b = (cut){ p->ro.m, p->ro.l };
+  if (p->ro.l > DFM_ROW_CACHE_LEN) return h;
+  memcpy(p->rb[i], p->ro.m, p->ro.l);
+  *r = (struct fm_row){ o, h, w, (u16)p->ro.l, p->dv, f };
+  return h;
+}
+
+//
+// Hash a grid view line of up to g cells starting at entry *c and advance
+// *c past it.
+//
+static inline u32
+fm_draw_line(struct fm *p, usize *c, usize g)
+{
+  u32 h = 2166136261u;
+  cut b;
+  for (usize i = 0; i < g && *c != SIZE_MAX; i++) {
+    h = (h ^ fm_draw_row(p, *c, &b)) * 16777619u;
+    *c = ent_next(p, *c + 1);
+  }
+  return h > 1 ? h : 2;
+}
+
+static inline void
+fm_draw_line_push(struct fm *p, usize c, usize g)
+{
+  cut b;
+  for (usize i = 0; i < g && c != SIZE_MAX; i++) {
+    fm_draw_row(p, c, &b);
+    str_push(&p->io, b.d, b.l);
+    c = ent_next(p, c + 1);
+  }
+  STR_PUSH(&p->io, VT_EL0 VT_CR);
+}
+
+static inline int
+fm_draw_shadow(struct fm *p, usize y, u32 h)
+{
+  if (y >= DFM_ROW_MAX) return 1;
+  if (p->sh[y] == h) return 0;
+  p->sh[y] = h;
+  return 1;
+}
+
+static inline void
+fm_draw_shadow_clear(struct fm *p)
+{
+  memset(p->sh, 0, sizeof(p->sh));
+  memset(p->ph, 0, sizeof(p->ph));
+  p->sc = SIZE_MAX;
+}
+
+//
+// Shift the shadow after the terminal scrolled the list region by d rows,
+// up (d > 0) or down (d < 0).
+//
+static inline void
+fm_draw_shadow_scroll(struct fm *p, int d)
+{
+  usize n = MIN(p->row, DFM_ROW_MAX);
+  usize k = (usize)(d < 0 ? -d : d);
+  if (k >= n) {
+    memset(p->sh, 0, n * sizeof(*p->sh));
+    return;
+  }
+  if (d > 0) {
+    memmove(p->sh, p->sh + k, (n - k) * sizeof(*p->sh));
+    memset(p->sh + n - k, 0, k * sizeof(*p->sh));
+  } else {
+    memmove(p->sh + k, p->sh, (n - k) * sizeof(*p->sh));
+    memset(p->sh, 0, k * sizeof(*p->sh));
+  }
 }
 
 static inline usize
@@ -1374,32 +2141,140 @@ fm_draw_search_query(struct fm *p, usize qw)
 static inline void
 fm_draw_dir(struct fm *p)
 {
-  usize s = p->y >= p->o ? p->y - p->o : 0;
-  usize m = p->vl - s;
+  usize g = fm_grid(p);
+  usize s = (p->y / g >= p->o ? p->y / g - p->o : 0) * g;
+  usize m = (p->vl - s + g - 1) / g;
   usize d = MIN(m, p->row);
   usize c = fm_visible_select(p, s);
-  STR_PUSH(&p->io, VT_CUP1);
+  usize y = SIZE_MAX;
 
-  for (usize i = 0; i < d && c != SIZE_MAX; i++) {
-    fm_draw_ent(p, c);
-    STR_PUSH(&p->io, VT_CUD1);
-    c = ent_next(p, c + 1);
+  if (g != p->sg) {
+    fm_draw_shadow_clear(p);
+    p->sg = g;
   }
 
-  for (usize i = d; i < p->row; i++)
-    STR_PUSH(&p->io, VT_EL2 VT_CUD1);
+  //
+  // If the entry that was on top last time is still at the same rank the
+  // list only moved: scroll the region and let the damage pass fill in the
+  // exposed rows.
+  //
+  if (p->sc < p->dl && s != p->sy && !fm_panes(p) &&
+      fm_visible_select(p, p->sy) == p->sc) {
+    usize k = (s > p->sy ? s - p->sy : p->sy - s) / g;
+    if (k < p->row) {
+      if (s > p->sy) vt_su(&p->io, k);
+      else vt_sd(&p->io, k);
+      fm_draw_shadow_scroll(p, s > p->sy ? (int)k : -(int)k);
+    }
+  }
+  p->sy = s;
+  p->sc = c;
+
+  for (usize i = 0; i < p->row; i++) {
+    u32 h = 1;
+    cut b = CUT_NULL;
+    usize n = c;
+    if (i < d && c != SIZE_MAX && g > 1)
+      h = fm_draw_line(p, &c, g);
+    else if (i < d && c != SIZE_MAX) {
+      h = fm_draw_row(p, c, &b);
+      c = ent_next(p, c + 1);
+    }
+    if (!fm_draw_shadow(p, i, h)) continue;
+    if (y != SIZE_MAX && y + 1 == i && !p->px) STR_PUSH(&p->io, VT_CUD1);
+    else vt_cup(&p->io, p->px + 1, i + 1);
+    if (h != 1 && g > 1) fm_draw_line_push(p, n, g);
+    else if (b.l) str_push(&p->io, b.d, b.l);
+    else if (fm_panes(p)) STR_PUSH(&p->io, VT_EL0);
+    else STR_PUSH(&p->io, VT_EL2);
+    // Rows end by clearing to the right, over the child pane.
+    if (i < DFM_ROW_MAX) p->ph[1][i] = 0;
+    y = i;
+  }
 }
 
 static inline void
-fm_draw_nav_begin(struct fm *p, cut c)
+fm_draw_pane(struct fm *p, usize k, usize x, usize w, struct fm_pane *n, cut sel)
 {
-  vt_cup(&p->io, 0, p->row + (DFM_MARGIN - 1));
-  str_push(&p->io, c.d, c.l);
-  str_memset(&p->io, ' ', p->col);
-  STR_PUSH(&p->io, VT_CR);
-}
-
-static inline void
+  if (w < 2) return;
+  int hd = !(p->f & FM_HIDDEN);
+  usize j = 0;
+  usize t = 0;
+  if (n && sel.l) {
+    usize r = 0;
+    for (; j < n->n; j++) {
+      const char *e = n->e[j];
+      if (hd && e[0] == '.') continue;
+      if (!strncmp(e, sel.d, sel.l) && !e[sel.l]) break;
+      r++;
+    }
+    t = j < n->n && r > p->row / 2 ? r - p->row / 2 : 0;
+    j = 0;
+  }
+  for (usize i = 0; i < p->row; i++) {
+    const char *e = NULL;
+    while (n && j < n->n) {
+      const char *c = n->e[j++];
+      if (hd && c[0] == '.') continue;
+      if (t) { t--; continue; }
+      e = c;
+      break;
+    }
+    p->ro.l = 0;
+    usize c = 0;
+    if (e) {
+      u8 ty = (u8)e[-1];
+      u8 u;
+      u8 ct;
+      usize l = ent_name_len(e, &u, &ct);
+      u64 m = 0;
+      ent_set(&m, UTF8, u);
+      ent_set(&m, CTRL, ct);
+      fm_draw_ent_col(&p->ro, ty);
+      if (sel.l && l == sel.l && !memcmp(e, sel.d, l))
+        STR_PUSH(&p->ro, DFM_COL_CURSOR);
+      c = fm_draw_name_ellipsis(p, &p->ro, m, e, l, w - 1);
+      if (ENT_IS_DIR(ty)) {
+        str_push_c(&p->ro, '/');
+        c++;
+      }
+      STR_PUSH(&p->ro, VT_SGR0);
+    }
+    str_memset(&p->ro, ' ', w - c);
+    u32 h = hash_fnv1a32(p->ro.m, p->ro.l);
+    if (i < DFM_ROW_MAX) {
+      if (p->ph[k][i] == h) continue;
+      p->ph[k][i] = h;
+    }
+    vt_cup(&p->io, x + 1, i + 1);
+    str_push(&p->io, p->ro.m, p->ro.l);
+  }
+}
+
+static inline void
+fm_draw_panes(struct fm *p)
+{
+  usize i = p->pwd.l;
+  while (i > 0 && p->pwd.m[i - 1] != '/') i--;
+  cut b = { p->pwd.m + i, p->pwd.l - i };
+  cut ap[3];
+  cut ac[3];
+  struct fm_pane *pp = fm_pane_get(p, fm_pane_key_parent(p, ap), ap);
+  struct fm_pane *pc = fm_pane_get(p, fm_pane_key_child(p, ac), ac);
+  fm_draw_pane(p, 0, 0, p->px, pp, b);
+  fm_draw_pane(p, 1, p->px + p->lw, p->col - p->px - p->lw, pc, CUT_NULL);
+}
+
+static inline void
+fm_draw_nav_begin(struct fm *p, cut c)
+{
+  vt_cup(&p->io, 0, p->row + (DFM_MARGIN - 1));
+  str_push(&p->io, c.d, c.l);
+  str_memset(&p->io, ' ', p->col);
+  STR_PUSH(&p->io, VT_CR);
+}
+
+static inline void
 fm_draw_nav_end(struct fm *p)
 {
   STR_PUSH(&p->io, VT_SGR0);
@@ -1435,6 +2310,10 @@ fm_draw_inf(struct fm *p)
   else str_push_c(&p->io, 'T');
   if (unlikely(p->f & FM_ERROR))  { str_push_c(&p->io, 'E'); vw--; }
   if (unlikely(p->f & FM_HIDDEN)) { str_push_c(&p->io, 'H'); vw--; }
+  if (unlikely(p->vf == ENT_MASK_DIR))  { str_push_c(&p->io, 'D'); vw--; }
+  if (unlikely(p->vf == ENT_MASK_EXEC)) { str_push_c(&p->io, 'X'); vw--; }
+  if (unlikely(p->f & FM_FIND))   { str_push_c(&p->io, 'F'); vw--; }
+  if (unlikely(p->f & FM_GREP))   { str_push_c(&p->io, 'G'); vw--; }
   STR_PUSH(&p->io, "] ");
 
   if (vw > 10 && p->vml) {
@@ -1446,6 +2325,36 @@ fm_draw_inf(struct fm *p)
     vw -= 4;
   }
 
+  if (vw > 10 && p->jn) {
+    u64 b = 0;
+    u64 t = 0;
+    u64 n = 0;
+    u64 tn = 0;
+    for (usize i = 0; i < DFM_JOB_MAX; i++) {
+      if (!p->jb[i].pid) continue;
+      b  += p->jg[i].nb;
+      t  += p->jg[i].tb;
+      n  += p->jg[i].nf;
+      tn += p->jg[i].tf;
+    }
+    if (!t) {
+      b = n;
+      t = tn;
+    }
+    STR_PUSH(&p->io, DFM_COL_NAV_JOB " ");
+    vw -= str_push_u32(&p->io, (u32)p->jn);
+    STR_PUSH(&p->io, "& ");
+    if (t) {
+      vw -= str_push_u32(&p->io, (u32)(MIN(b, t) * 100 / t));
+      str_push_c(&p->io, '%');
+    } else
+      vw -= str_push_u32(&p->io, (u32)MIN(n, UINT32_MAX));
+    STR_PUSH(&p->io, " " VT_SGR0);
+    str_push(&p->io, c.d, c.l);
+    str_push_c(&p->io, ' ');
+    vw -= 6;
+  }
+
   if (vw > 20 && likely(!(p->f & FM_TRUNC))) {
     STR_PUSH(&p->io, "~");
     vw -= ent_size_decode(&p->io, p->du, 0, ENT_TYPE_MAX);
@@ -1510,8 +2419,11 @@ fm_draw_nav(struct fm *p)
     fm_draw_buf(p, p->f & FM_MSG ? CUT(DFM_COL_NAV_MSG) : CUT(DFM_COL_NAV_ERR));
     rl_clear(&p->r);
     p->f &= ~(FM_MSG|FM_MSG_ERR);
-  } else
+    p->f |= FM_NAV_MSG;
+  } else {
     fm_draw_inf(p);
+    p->f &= ~FM_NAV_MSG;
+  }
 }
 
 // }}}
@@ -1529,7 +2441,7 @@ fm_cursor_set(struct fm *p, usize y, usize o)
   }
   if (y >= p->vl) y = p->vl - 1;
   if (o >= p->row) o = p->row - 1;
-  if (o > y) o = y;
+  if (o > y / fm_grid(p)) o = y / fm_grid(p);
   p->y = y;
   p->o = o;
   p->c = fm_visible_select(p, y);
@@ -1541,34 +2453,41 @@ fm_scroll_to(struct fm *p, cut d)
   if (!p->vl) goto e;
   u16 i;
   fm_dir_ht_find(p, d, &i);
-  if (i == 0xFFFF || !ent_v_geto(p, i, VIS))
+  if (i == 0xFFFF || !fm_v_get(p, i))
     goto e;
+  usize g = fm_grid(p);
   usize r = fm_filter_pct_rank(p, i);
-  usize ms = p->vl > p->row ? p->vl - p->row : 0;
+  usize l = r / g;
+  usize n = (p->vl + g - 1) / g;
+  usize ms = n > p->row ? n - p->row : 0;
   usize h = p->row >> 1;
-  usize s = r <= p->row - 2 ? 0 : r >= ms ? ms : r > h ? r - h : 0;
+  usize s = l <= p->row - 2 ? 0 : l >= ms ? ms : l > h ? l - h : 0;
   if (s > ms) s = ms;
-  fm_cursor_set(p, r, r - s);
+  fm_cursor_set(p, r, l - s);
   return;
 e:
   fm_cursor_set(p, 0, 0);
 }
 
-static inline size
+//
+// Move the cursor to rank r, scrolling as little as possible when it is near
+// the screen and centering it otherwise.
+//
+static inline void
 fm_scroll_to_rank(struct fm *p, usize r)
 {
-  size dy = (size)r - (size)p->y;
-  if (!dy || !p->vl) return 0;
-  if (dy > (size)p->row || dy < -(size)p->row) {
-    size h = (size)p->row >> 1;
-    size j = (size)r - (dy > 0 ? h : -h);
-    if (j < 0) j = 0;
-    if (j >= (size)p->vl) j = (size)p->vl - 1;
-    fm_cursor_set(p, (usize)j, 0);
-    p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
-    dy = (size)r - (size)p->y;
-  }
-  return dy;
+  usize g = fm_grid(p);
+  usize l = r / g;
+  usize t = p->y / g - p->o;
+  usize o;
+  if (l >= t && l < t + p->row)
+    o = l - t;
+  else if (l + p->row < t || l >= t + p->row + p->row)
+    o = p->row >> 1;
+  else
+    o = l < t ? 0 : p->row - 1;
+  fm_cursor_set(p, r, o);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
 static inline void
@@ -1582,7 +2501,7 @@ fm_cursor_sync(struct fm *p)
   }
   if (p->y >= p->vl) p->y = p->vl - 1;
   if (p->o >= p->row) p->o = p->row - 1;
-  if (p->o > p->y) p->o = p->y;
+  if (p->o > p->y / fm_grid(p)) p->o = p->y / fm_grid(p);
   p->c = fm_visible_select(p, p->y);
 }
 
@@ -1596,6 +2515,7 @@ fm_term_resize(struct fm *p)
   if (term_size_update(&p->t, &p->row, &p->col) < 0)
     return -1;
   p->row = p->row > DFM_MARGIN ? p->row - DFM_MARGIN : 1;
+  fm_pane_layout(p);
   rl_vw_set(&p->r, p->col);
   vt_decstbm(&p->io, 1, p->row);
   fm_cursor_set(p, p->y, p->o);
@@ -1680,6 +2600,17 @@ fm_mark_at(struct fm *p, usize i)
   return (cut) { m, fm_mark_len(m) };
 }
 
+//
+// Name a mark takes in another directory. Marks made on find results are
+// paths relative to the mark directory.
+//
+static inline cut
+fm_mark_base(cut m)
+{
+  const char *b = basename_l(m.d, m.l);
+  return (cut) { b, m.l - (usize) (b - m.d) };
+}
+
 static inline void
 fm_mark_terminate(struct fm *p)
 {
@@ -1966,21 +2897,44 @@ fm_dir_has_room(const struct fm *p, usize e)
 static inline void
 fm_dir_rebuild_loc(struct fm *p)
 {
+  u64 g[BITSET_W(DFM_DIR_MAX)];
+  bool gs = p->f & FM_GREP_SET;
+  if (gs) {
+    memcpy(g, p->gc, BITSET_W(p->dl) * sizeof(*g));
+    memset(p->gc, 0, BITSET_W(p->dl) * sizeof(*p->gc));
+  }
+  memset(p->vm, 0, BITSET_W(p->dl) * sizeof(*p->vm));
+  fm_v_attr_clear(p);
   for (usize i = 0; i < p->dl; i++) {
     u64 m = ent_load(p, i);
+    if (gs && bitset_get(g, ent_get(m, LOC))) bitset_set(p->gc, i);
     ent_set(&m, LOC, (u16)i);
     ent_store(p, i, m);
+    u32 x = ent_v_load(p, i);
+    if (ent_v_get(x, MARK)) bitset_set(p->vm, i);
+    if (!ent_v_get(x, TOMB))
+      fm_v_attr_set(p, i, ent_get(m, TYPE), ent_v_get(x, DOT));
   }
 }
 
 static inline void
 fm_dir_sort(struct fm *p)
 {
+  //
+  // Sizes streaming in from du mode leave the listing nearly sorted, which
+  // the insertion sort finishes in close to one pass.
+  //
   if (likely(!(p->f & FM_TRUNC))) {
-    fm_ent_qsort(p, fm_sort_fn(p->ds), 0, p->dl, 32);
+    if (p->f & FM_DIRTY_SIZE)
+      fm_ent_isort(p, fm_sort_fn(p->ds), 0, p->dl);
+    else
+      fm_ent_qsort(p, fm_sort_fn(p->ds), 0, p->dl, 32);
     fm_dir_rebuild_loc(p);
   }
-  fm_filter f = rl_empty(&p->r) ? fm_filter_hidden : p->sf;
+  p->f &= ~FM_DIRTY_SIZE;
+  bool q = !rl_empty(&p->r) && !(p->f & (FM_MSG|FM_MSG_ERR));
+  fm_filter f = q ? p->sf : fm_filter_hidden;
+  if (!q && p->f & FM_GREP_SET) f = fm_filter_grep;
   fm_filter_apply(p, f, rl_cl_get(&p->r), rl_cr_get(&p->r));
   fm_cursor_set(p, p->y, p->o);
 }
@@ -2013,19 +2967,57 @@ fm_dir_mark_rebuild(struct fm *p)
   }
 }
 
+//
+// Stop the du walk of a listing that is gone. The job may run a little longer
+// but only ever writes to its own mapping.
+//
+static inline void
+fm_du_stop(struct fm *p)
+{
+  if (p->dj) kill(-p->dj, SIGTERM);
+  p->dj = 0;
+  if (p->dr) munmap(p->dr, p->drl);
+  p->dr = NULL;
+}
+
+//
+// Same for the walk of a recursive find.
+//
+static inline void
+fm_find_stop(struct fm *p)
+{
+  if (p->fj) kill(-p->fj, SIGTERM);
+  p->fj = 0;
+  if (p->fr) munmap(p->fr, p->frl);
+  p->fr = NULL;
+  p->f &= ~FM_WALK;
+  p->f |= FM_REDRAW_NAV;
+}
+
 static inline void
 fm_dir_clear(struct fm *p)
 {
+  p->f &= ~FM_DU;
+  fm_du_stop(p);
+  if (p->f & FM_GREP_SET) {
+    p->f &= ~(FM_SEARCH|FM_GREP|FM_GREP_SET);
+    p->vql = 0;
+    p->vqw = 0;
+  }
   p->y = 0;
   p->o = 0;
   p->c = 0;
   p->f &= ~FM_TRUNC;
   rl_clear(&p->r);
+  fm_v_attr_clear(p);
   p->del = 0;
   p->dl = 0;
+  p->vl = 0;
   p->du = 0;
+  p->dw = 0;
   p->st = 0;
   fm_dir_ht_clear(p);
+  fm_row_clear(p);
 }
 
 static inline int
@@ -2103,6 +3095,8 @@ w:
   u64 sz = ent_size_bytes(ent_get(m, SIZE), ent_get(m, TYPE));
   p->du = ent_size_add(p->du, sz);
 t:
+  if (!((p->dl - 1) & 63)) p->vp[(p->dl - 1) >> 6] = (u16)p->vl;
+  fm_v_attr_set(p, p->dl - 1, ent_get(m, TYPE), s[0] == '.');
   fm_dir_ht_insert(p, (cut){ s, l }, (u16)(p->dl - 1), &m);
   memcpy(p->de + o, &m, sizeof(m));
   return 0;
@@ -2127,6 +3121,7 @@ fm_dir_load(struct fm *p)
   fm_dir_sort(p);
   fm_dir_mark_rebuild(p);
   fs_watch(&p->p, ".");
+  if (p->dz) p->f |= FM_DU;
   return 1;
 }
 
@@ -2137,10 +3132,11 @@ fm_dir_add(struct fm *p, cut c)
     return 0;
   if (fm_dir_load_ent(p, c.d) == -1)
     return -1;
-  int h = !(p->f & FM_HIDDEN) && *c.d == '.';
-  fm_v_assign(p, p->dl - 1, !h);
+  usize i = p->dl - 1;
+  fm_v_assign(p, i, (fm_v_base(p, i >> 6) >> (i & 63)) & 1);
   p->f |= FM_DIRTY;
   p->st = ent_v_geto(p, p->dl - 1, OFF);
+  fm_row_drop(p, p->st);
   return 0;
 }
 
@@ -2159,12 +3155,44 @@ fm_dir_del(struct fm *p, cut c)
   ent_v_set(&x, TOMB, 1);
   ent_v_set(&x, MARK, 0);
   ent_v_store(p, f, x);
+  fm_v_attr_clr(p, f, ent_get(m, TYPE));
 
   fm_dir_ht_remove(p, s);
   p->f |= FM_DIRTY;
   return 0;
 }
 
+//
+// Swallow the attribute event caused by our own chmod or chown of an entry
+// whose new mode was already stored.
+//
+static inline int
+fm_dir_echo(struct fm *p, cut c)
+{
+  u16 f;
+  fm_dir_ht_find(p, c, &f);
+  if (f == 0xFFFF) return 0;
+  u32 x = ent_v_load(p, f);
+  if (!ent_v_get(x, ECHO)) return 0;
+  ent_v_set(&x, ECHO, 0);
+  ent_v_store(p, f, x);
+  return 1;
+}
+
+//
+// An entry changed in place is loaded again, and stays in the result of a
+// content search it was in.
+//
+static inline void
+fm_dir_change(struct fm *p, cut c)
+{
+  u16 j;
+  fm_dir_ht_find(p, c, &j);
+  bool g = p->f & FM_GREP_SET && j != 0xFFFF && bitset_get(p->gc, j);
+  fm_dir_del(p, c);
+  if (!fm_dir_add(p, c) && g) bitset_set(p->gc, p->dl - 1);
+}
+
 static inline void
 fm_dir_refresh(struct fm *p)
 {
@@ -2198,6 +3226,8 @@ fm_path_change(struct fm *p)
       S("not enough memory to materialize marks, unmark to cd"), 0);
     return 0;
   }
+  fm_find_stop(p);
+  p->f &= ~FM_FIND;
   return 1;
 }
 
@@ -2313,18 +3343,8 @@ fm_path_cd_up(struct fm *p)
 }
 
 static inline int
-fm_exec(struct fm *p, int in, const char *d, const char *const a[], bool bg, bool tf)
+fm_exec_status(struct fm *p, int r)
 {
-  if (tf) fm_term_cooked(p);
-  int r = run_cmd(bg ? p->t.null : p->t.fd, in, d, a, bg);
-  if (tf) fm_term_raw(p);
-  if (r == -1) {
-    if (errno == ENOENT)
-      fm_draw_err(p, S("exec: command not found"), 0);
-    else
-      fm_draw_err(p, S("exec"), errno);
-    return -1;
-  }
   if (WIFEXITED(r)) {
     int ec = WEXITSTATUS(r);
     if (ec == 127) {
@@ -2342,6 +3362,22 @@ fm_exec(struct fm *p, int in, const char *d, const char *const a[], bool bg, boo
   return 0;
 }
 
+static inline int
+fm_exec(struct fm *p, int in, const char *d, const char *const a[], bool bg, bool tf)
+{
+  if (tf) fm_term_cooked(p);
+  int r = run_cmd(bg ? p->t.null : p->t.fd, in, d, a, bg);
+  if (tf) fm_term_raw(p);
+  if (r == -1) {
+    if (errno == ENOENT)
+      fm_draw_err(p, S("exec: command not found"), 0);
+    else
+      fm_draw_err(p, S("exec"), errno);
+    return -1;
+  }
+  return fm_exec_status(p, r);
+}
+
 static inline void
 fm_open(struct fm *p)
 {
@@ -2363,479 +3399,2560 @@ fm_open(struct fm *p)
 
 // }}}
 
-// Command {{{
+// Find {{{
 
-struct fm_cmd {
-  cut prompt;
-  cut left;
-  cut right;
-  fm_key_press press;
-  fm_key_enter enter;
-  u32 config;
+//
+// Recursive find lists matches from the whole tree below PWD in place of the
+// directory entries. The names of the matches are their paths relative to PWD
+// so everything operating on entries (marks, commands, open, ...) works on
+// them unchanged. The tree is walked by a job of DFM_FIND_PAR processes. The
+// first reads PWD itself and the top level directories are then shared out
+// between them like the entries of a du walk. Matches are appended to a log
+// in memory shared with the job and taken into the listing DFM_FIND_STEP at a
+// time between input, so they stream in and the walk can be cancelled at any
+// time.
+//
+// A record in the log is its length (including the NUL) followed by the path.
+// A writer reserves room for its record first and stores the length last, so
+// the reader stops at the first record not written yet.
+//
+struct fm_find {
+  usize i;
+  usize n;
+  usize k;
+  usize l;
+  usize c;
+  char r[];
 };
 
-#define FM_CMD(C, ...)                                                         \
-static inline void                                                             \
-C(struct fm *p)                                                                \
-{                                                                              \
-  fm_cmd(p, &(struct fm_cmd){__VA_ARGS__});                                    \
+//
+// Patterns from every '.gitignore' on the way down from PWD are kept as a
+// stack, each level remembering where its patterns start so they are
+// dropped again on the way back up. A pattern containing a slash is matched
+// against the path below the directory its '.gitignore' is in, which starts
+// at offset o of the walk path.
+//
+static inline void
+fm_find_ignore_load(struct fm *p, int dfd, usize o)
+{
+  int fd = openat(dfd, ".gitignore", O_RDONLY|O_CLOEXEC);
+  if (fd < 0) return;
+  char b[DFM_FIND_IGNORE_MAX];
+  ssize_t r = read(fd, b, sizeof(b) - 1);
+  close(fd);
+  if (r <= 0) return;
+  u16 po = (u16) o;
+  for (usize i = 0, l; i < (usize)r; i += l + 1) {
+    const char *s = b + i;
+    for (l = 0; i + l < (usize)r && s[l] != '\n'; l++);
+    usize n = l;
+    for (; n && (s[n - 1] == ' ' || s[n - 1] == '\r'); n--);
+    if (!n || *s == '#' || *s == '!') continue;
+    u8 t = 0x80;
+    if (n > 1 && s[n - 1] == '/') { t |= 1; n--; }
+    if (memchr(s, '/', n)) t |= 2;
+    if (*s == '/') { s++; n--; }
+    if (!n || p->fil + n + 2 + sizeof(po) > sizeof(p->fi)) continue;
+    p->fi[p->fil++] = (char)t;
+    memcpy(p->fi + p->fil, &po, sizeof(po));
+    p->fil += sizeof(po);
+    memcpy(p->fi + p->fil, s, n);
+    p->fil += n;
+    p->fi[p->fil++] = 0;
+  }
 }
 
-enum {
-  CMD_BG           = 1 << 0,
-  CMD_CONFLICT     = 1 << 1,
-  CMD_MUT          = 1 << 2,
-  CMD_EXEC         = 1 << 3,
-  CMD_MARK_DIR     = 1 << 4,
-  CMD_NOT_MARK_DIR = 1 << 5,
-  CMD_STDIN        = 1 << 6,
-  CMD_FILE_CURSOR  = 1 << 7,
-  CMD_EXEC_MARK    = 1 << 8,
-  CMD_EXEC_ROOT    = 1 << 9,
-
-  CMD_MODE_EACH    = 0,
-  CMD_MODE_VIRTUAL,
-  CMD_MODE_CHUNK,
-  CMD_MODE_BULK,
-  CMD_MODE_SINGLE,
-};
+static inline int
+fm_find_ignored(struct fm *p, int d)
+{
+  const char *n = p->w.p + p->w.b;
+  if (d && !strcmp(n, ".git")) return 1;
+  for (usize i = 0; i < p->fil; ) {
+    u8 t = (u8)p->fi[i++];
+    u16 o;
+    memcpy(&o, p->fi + i, sizeof(o));
+    i += sizeof(o);
+    const char *g = p->fi + i;
+    i += strlen(g) + 1;
+    if (t & 1 && !d) continue;
+    if (!fnmatch(g, t & 2 ? p->w.p + o : n, t & 2 ? FNM_PATHNAME : 0))
+      return 1;
+  }
+  return 0;
+}
 
-static inline void
-fm_cmd_exec(struct fm *p)
+static inline int
+fm_find_match(struct fm *p)
 {
-  if (p->kd && p->kd(p, &p->r.cl) >= 0)
-    rl_clear(&p->r);
-  p->r.vx = 0;
-  p->r.pr.l = 0;
-  p->kp = 0;
-  p->kd = 0;
+  int r = !!strchr(p->fq, '/');
+  return !fnmatch(p->fq, r ? p->w.p : p->w.p + p->w.b, r ? FNM_PATHNAME : 0);
 }
 
-static inline void
-fm_cmd(struct fm *p, struct fm_cmd *c)
+static inline int
+fm_find_put(struct fm_find *x, const char *s, usize l)
 {
-  if (!c->press && !c->enter) {
-    fm_draw_err(p, S("no callbacks defined"), 0);
-    return;
-  }
-  rl_clear(&p->r);
-  rl_pr_set(&p->r, c->prompt);
-  if (c->left.l) {
-    str_push(&p->r.cl, c->left.d, c->left.l);
-    str_terminate(&p->r.cl);
+  usize z = (sizeof(u32) + l + 1 + 3) & ~(usize)3;
+  usize o = __atomic_fetch_add(&x->l, z, __ATOMIC_RELAXED);
+  if (o + z > x->c) return -1;
+  memcpy(x->r + o + sizeof(u32), s, l + 1);
+  __atomic_store_n((u32 *)(void *)(x->r + o), (u32)(l + 1), __ATOMIC_RELEASE);
+  return 0;
+}
+
+//
+// Look at the entry the walk is on. Returns 1 for a directory to enter, 0
+// otherwise and -1 once the log is full. Entry names are at most
+// DFM_NAME_MAX bytes, a longer relative path is counted and reported once
+// the walk is done.
+//
+static inline int
+fm_find_ent(struct fm *p, struct fm_find *x)
+{
+  struct walk *w = &p->w;
+  const char *n = w->p + w->b;
+  if (*n == '.' && !(p->f & FM_HIDDEN)) return 0;
+  u8 t = w->t;
+  if (t == WALK_T_UNKNOWN) {
+    struct stat st;
+    if (fstatat(walk_dfd(w), n, &st, AT_SYMLINK_NOFOLLOW) == -1)
+      return 0;
+    t = S_ISDIR(st.st_mode) ? WALK_T_DIR : WALK_T_OTHER;
   }
-  if (c->right.l) rl_cr_set(&p->r, c->right);
-  if (c->config & CMD_FILE_CURSOR) {
-    if (p->c == SIZE_MAX) return;
-    cut e = fm_ent(p, p->c);
-    str_push(&p->r.cl, e.d, e.l);
+  int d = t == WALK_T_DIR;
+  if (fm_find_ignored(p, d)) return 0;
+  if (fm_find_match(p)) {
+    if (w->l >= DFM_NAME_MAX)
+      __atomic_add_fetch(&x->k, 1, __ATOMIC_RELAXED);
+    else if (fm_find_put(x, w->p, w->l) < 0)
+      return -1;
   }
-  rl_cl_sync(&p->r);
-  p->cf = c->config;
-  p->kp = c->press;
-  p->kd = c->enter;
-  p->f |= FM_REDRAW_CMD;
-  if (p->f & FM_ROOT && !(p->cf & CMD_EXEC_ROOT))
-    return;
-  if ((p->cf & CMD_EXEC_MARK && p->vml) || p->cf & CMD_EXEC) {
-    rl_join(&p->r);
-    fm_cmd_exec(p);
+  return d;
+}
+
+static inline int
+fm_find_tree(struct fm *p, struct fm_find *x, const char *s)
+{
+  struct walk *w = &p->w;
+  if (walk_open(w, p->dfd, s) < 0) return 0;
+  p->fo[0] = p->fil;
+  fm_find_ignore_load(p, walk_dfd(w), w->o[0]);
+  for (int r; (r = walk_next(w)); ) {
+    if (r != WALK_ENT) {
+      p->fil = p->fo[w->n];
+      continue;
+    }
+    int d = fm_find_ent(p, x);
+    if (d < 0) {
+      walk_close(w);
+      return -1;
+    }
+    if (!d || walk_push(w) < 0) continue;
+    p->fo[w->n - 1] = p->fil;
+    fm_find_ignore_load(p, walk_dfd(w), w->o[w->n - 1]);
   }
+  return 0;
 }
 
 static inline void
-fm_cmd_search_press(struct fm *p, int k, cut cl, cut cr)
-{
-  if (cl.l > 1 && k != KEY_BACKSPACE && p->vl != p->dl && !cr.l) {
-    fm_filter_apply_inc(p, p->sf, cl, cr);
-  } else
-    fm_filter_apply(p, p->sf, cl, cr);
-  fm_filter_save(p, cl, cr);
-  fm_cursor_set(p, 0, 0);
+fm_find_work(struct fm *p, struct fs_prog *g, const char *u, usize n)
+{
+  struct fm_find *x = p->fr;
+  usize c = __atomic_fetch_add(&x->i, 1, __ATOMIC_RELAXED);
+  for (usize k = 0; k < n && c < n; k++, u += strlen(u) + 1) {
+    if (k != c) continue;
+    if (fm_find_tree(p, x, u) < 0) return;
+    __atomic_add_fetch(&g->nf, 1, __ATOMIC_RELAXED);
+    c = __atomic_fetch_add(&x->i, 1, __ATOMIC_RELAXED);
+  }
 }
 
+//
+// The top level directories are collected in memory of the job's own which
+// the processes forked after share.
+//
 static inline int
-fm_cmd_search(struct fm *p, str *s)
-{
-  if (p->vl == 1) fm_open(p);
-  else {
-    if (s->l) {
-      cut q = (cut){ s->m, s->l };
-      fm_filter_apply(p, p->sf, q, CUT_NULL);
-      fm_filter_save(p, q, CUT_NULL);
+fm_job_find(struct fm *p, struct fs_prog *g)
+{
+  struct fm_find *x = p->fr;
+  struct walk *w = &p->w;
+  p->fil = 0;
+  fm_find_ignore_load(p, p->dfd, 0);
+  char *u = mmap(NULL, DFM_ENT_MAX, PROT_READ|PROT_WRITE,
+    MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (u == MAP_FAILED || walk_open(w, p->dfd, ".") < 0) {
+    fs_prog_err(g, ".", errno);
+    return -1;
+  }
+  usize ul = 0;
+  usize n = 0;
+  for (int r; (r = walk_next(w)); ) {
+    if (r != WALK_ENT) continue;
+    int d = fm_find_ent(p, x);
+    if (d < 0) {
+      walk_close(w);
+      return 0;
     }
-    else
-      fm_filter_apply(p, fm_filter_hidden, (cut){ s->m, s->l }, CUT_NULL);
-    fm_cursor_set(p, 0, 0);
+    if (!d) continue;
+    if (ul + w->l + 1 > DFM_ENT_MAX) {
+      fs_prog_err(g, w->p, ENOMEM);
+      continue;
+    }
+    memcpy(u + ul, w->p, w->l + 1);
+    ul += w->l + 1;
+    n++;
   }
-  return -1;
+  g->tf = n;
+  for (usize i = 1; i < DFM_FIND_PAR; i++)
+    if (!fork()) {
+      fm_find_work(p, g, u, n);
+      _exit(0);
+    }
+  fm_find_work(p, g, u, n);
+  while (wait(NULL) > 0 || errno == EINTR);
+  return g->ne ? -1 : 0;
 }
 
 static inline int
-fm_cmd_cd(struct fm *p, str *s)
+fm_find_add(struct fm *p, const char *s)
 {
-  int r = 0;
-  if (s->m[0] == '/')
-    r = fm_path_cd(p, s->m, s->l);
-  else
-    r = fm_path_cd_relative(p, s->m, s->l);
-  return r ? 0 : -1;
+  if (p->fn >= DFM_FIND_MAX) {
+    fm_find_stop(p);
+    fm_draw_msg(p, S("find: result limit reached"));
+    return -1;
+  }
+  if (fm_dir_load_ent(p, s) == -1) {
+    fm_find_stop(p);
+    p->f |= FM_TRUNC;
+    return -1;
+  }
+  fm_v_assign(p, p->dl - 1, 1);
+  p->fn++;
+  p->f |= FM_DIRTY;
+  return 0;
 }
 
-static u8
-fm_prompt_conflict(struct fm *p, cut d)
+static inline u32
+fm_find_next(const struct fm *p)
 {
-  fm_draw_nav_begin(p, CUT(DFM_COL_NAV_ERR));
-  STR_PUSH(&p->io, "conflict: '");
-  str_push(&p->io, d.d, d.l);
-  STR_PUSH(&p->io, "': try overwrite?");
-  STR_PUSH(&p->io, " [a]bort [y]es [Y]es all [n]o [N]o all");
-  fm_draw_nav_end(p);
-  fm_draw_flush(p);
+  const struct fm_find *x = p->fr;
+  if (!x || p->fc + sizeof(u32) > x->c) return 0;
+  return __atomic_load_n((const u32 *)(const void *)(x->r + p->fc),
+    __ATOMIC_ACQUIRE);
+}
+
+static inline void
+fm_find_end(struct fm *p)
+{
+  usize k = p->fr->k;
+  fm_find_stop(p);
+  if (!k) return;
+  fm_draw_msg(p, S("find: "));
+  str_push_u64(&p->r.cl, (u64) k);
+  STR_PUSH(&p->r.cl, " paths too long skipped");
+}
+
+//
+// The log is finished once the job has exited and the next record was never
+// written.
+//
+static inline void
+fm_find_step(struct fm *p)
+{
+  for (usize i = 0; i < DFM_FIND_STEP; i++) {
+    u32 l = fm_find_next(p);
+    if (!l) {
+      if (!p->fj) fm_find_end(p);
+      return;
+    }
+    const char *s = p->fr->r + p->fc + sizeof(u32);
+    p->fc += (sizeof(u32) + l + 3) & ~(usize)3;
+    if (fm_find_add(p, s) < 0) return;
+  }
+}
+
+//
+// Only PWD is watched, so a result is known to be gone when the top level
+// entry it is under was deleted or renamed away.
+//
+static inline void
+fm_find_del(struct fm *p, cut n)
+{
+  for (usize i = 0; i < p->dl; i++) {
+    if (ent_v_geto(p, i, TOMB)) continue;
+    cut e = fm_ent(p, i);
+    if (e.l < n.l || memcmp(e.d, n.d, n.l)) continue;
+    if (e.l == n.l || e.d[n.l] == '/') fm_dir_del(p, e);
+  }
+}
+
+static inline void
+fm_find_leave(struct fm *p)
+{
+  if (!fm_path_change(p)) return;
+  fm_dir_load(p);
+  fm_cursor_set(p, 0, 0);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
+
+// }}}
+
+// Grep {{{
+
+//
+// Content search reduces the visible entries (or the marks in PWD) to the
+// regular files containing the query. Files are read into a buffer of
+// DFM_GREP_WIN bytes at a time, each window overlapping the last by one byte
+// less than the query so no match is lost at a boundary. Reading (rather
+// than mapping) means a file truncated mid-scan just ends early. Scanning is
+// stepped DFM_GREP_STEP bytes at a time between input and matches show up
+// as they are found, and the file being scanned stays open between steps.
+//
+
+static inline int
+fm_grep_mem(const char *h, usize l, const char *q, usize ql)
+{
+  for (const char *e = h + l - ql + 1; h < e; h++) {
+    h = memchr(h, *q, (usize)(e - h));
+    if (!h) return 0;
+    if (!memcmp(h + 1, q + 1, ql - 1)) return 1;
+  }
+  return 0;
+}
+
+//
+// Entries not scanned yet are dropped from the candidates, which leaves the
+// matches behind.
+//
+static inline void
+fm_grep_close(struct fm *p)
+{
+  if (p->gd != -1) close(p->gd);
+  p->gd = -1;
+}
+
+static inline void
+fm_grep_stop(struct fm *p)
+{
+  fm_grep_close(p);
+  for (usize i = p->gi; (i = bitset_next_set(p->gc, i, p->dl)) != SIZE_MAX; )
+    bitset_clr(p->gc, i++);
+  p->f &= ~FM_GREP;
+  p->f |= FM_REDRAW_NAV;
+}
+
+//
+// Scan the next window of entry i and add its length to *b. Returns 1 on a
+// match, 0 when the entry is done and -1 when windows remain.
+//
+static inline int
+fm_grep_window(struct fm *p, usize i, usize *b)
+{
+  if (!p->go) {
+    fm_grep_close(p);
+    if (ent_v_geto(p, i, TOMB)) return 0;
+    cut n = fm_ent(p, i);
+    char s[DFM_NAME_MAX];
+    memcpy(s, n.d, n.l);
+    s[n.l] = 0;
+    int fd = openat(p->dfd, s, O_RDONLY|O_CLOEXEC|O_NONBLOCK);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+      close(fd);
+      return 0;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    p->gd = fd;
+  }
+  ssize_t l = pread(p->gd, p->gb, sizeof(p->gb), p->go);
+  int r = 0;
+  if (l > 0 && (p->go || !memchr(p->gb, 0, MIN((usize)l, DFM_GREP_BIN)))) {
+    r = (usize)l >= p->vql && fm_grep_mem(p->gb, (usize)l, p->vq, p->vql);
+    if (!r && (usize)l == sizeof(p->gb)) r = -1;
+    *b += (usize)l;
+  }
+  if (r == -1) p->go += l - (off_t)(p->vql ? p->vql - 1 : 0);
+  else fm_grep_close(p);
+  return r;
+}
+
+static inline void
+fm_grep_step(struct fm *p)
+{
+  int c = 0;
+  for (usize b = 0; b < DFM_GREP_STEP; b += DFM_GREP_BIN) {
+    usize i = bitset_next_set(p->gc, p->gi, p->dl);
+    if (i == SIZE_MAX) {
+      fm_grep_stop(p);
+      break;
+    }
+    int r = fm_grep_window(p, i, &b);
+    if (r == -1) continue;
+    if (r) { fm_v_assign(p, i, 1); c = 1; }
+    else bitset_clr(p->gc, i);
+    p->gi = i + 1;
+    p->go = 0;
+  }
+  if (!c) return;
+  if (p->c < p->dl && fm_v_get(p, p->c))
+    p->y = fm_filter_pct_rank(p, p->c);
+  fm_cursor_sync(p);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
+
+static inline int
+fm_grep_start(struct fm *p, cut q)
+{
+  if (q.l >= sizeof(p->vq)) {
+    fm_draw_err(p, S("grep: query too long"), 0);
+    return -1;
+  }
+  if (p->f & FM_WALK) fm_find_stop(p);
+  memset(p->gc, 0, sizeof(p->gc));
+  if (p->f & FM_MARK_PWD && p->vml)
+    memcpy(p->gc, p->vm, BITSET_W(p->dl) * sizeof(*p->gc));
+  else
+    memcpy(p->gc, p->v, BITSET_W(p->dl) * sizeof(*p->gc));
+  memset(p->v, 0, BITSET_W(p->dl) * sizeof(*p->v));
+  fm_v_rebuild(p);
+  p->sf = fm_filter_substr;
+  fm_filter_save(p, q, CUT_NULL);
+  fm_cursor_set(p, 0, 0);
+  fm_grep_close(p);
+  p->gi = 0;
+  p->go = 0;
+  p->f |= FM_SEARCH|FM_GREP|FM_GREP_SET|FM_REDRAW_DIR;
+  return 0;
+}
+
+// }}}
+
+// Disk Usage {{{
+
+//
+// Recursive sizes are worked out by a job of DFM_DU_PAR processes which take
+// the entries of the listing one at a time and walk them, counting both the
+// allocated (st_blocks) and apparent (st_size) size and each hard linked
+// file once. Finished entries are handed back through memory shared with the
+// job and applied to the listing as they come in. The totals of every
+// directory walked are kept in a shared cache keyed by device, inode and
+// modification time, so going back into a tree costs a stat per entry.
+//
+struct fm_du_ent {
+  u32 q;
+  u32 mn;
+  u64 d;
+  u64 i;
+  s64 ms;
+  u64 a;
+  u64 b;
+};
+
+struct fm_du {
+  usize i;
+  usize n;
+  usize d;
+  u64 h[DFM_DU_LINKS];
+  struct fm_du_unit {
+    u32 o;
+    u32 s;
+    u64 a;
+    u64 b;
+  } u[];
+};
+
+static inline u64
+fm_du_hash(dev_t d, ino_t i)
+{
+  u64 h = (u64) d * 0x9E3779B97F4A7C15ull ^ (u64) i;
+  h ^= h >> 31;
+  h *= 0xBF58476D1CE4E5B9ull;
+  return h ^ (h >> 29);
+}
+
+static inline bool
+fm_du_key(const struct fm_du_ent *c, const struct stat *st)
+{
+  return c->d == (u64) st->st_dev && c->i == (u64) st->st_ino &&
+    c->ms == (s64) st->FS_MTIM.tv_sec && c->mn == (u32) st->FS_MTIM.tv_nsec;
+}
+
+//
+// Slots are written by many processes at once. A writer takes a slot by
+// making its sequence odd and gives up if another holds it, a reader only
+// trusts what it read if the sequence was even and unchanged throughout.
+//
+static inline bool
+fm_du_cache_get(struct fm_du_ent *c, const struct stat *st, u64 *a, u64 *b)
+{
+  c += fm_du_hash(st->st_dev, st->st_ino) & (DFM_DU_CACHE - 1);
+  u32 q = __atomic_load_n(&c->q, __ATOMIC_ACQUIRE);
+  if (q & 1) return 0;
+  bool r = fm_du_key(c, st);
+  u64 ca = c->a;
+  u64 cb = c->b;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  if (!r || __atomic_load_n(&c->q, __ATOMIC_RELAXED) != q) return 0;
+  *a = ca;
+  *b = cb;
+  return 1;
+}
+
+static inline void
+fm_du_cache_put(struct fm_du_ent *c, const struct stat *st, u64 a, u64 b)
+{
+  c += fm_du_hash(st->st_dev, st->st_ino) & (DFM_DU_CACHE - 1);
+  u32 q = __atomic_load_n(&c->q, __ATOMIC_RELAXED);
+  if (q & 1 || !__atomic_compare_exchange_n(&c->q, &q, q + 1, 0,
+      __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    return;
+  c->d = (u64) st->st_dev;
+  c->i = (u64) st->st_ino;
+  c->ms = (s64) st->FS_MTIM.tv_sec;
+  c->mn = (u32) st->FS_MTIM.tv_nsec;
+  c->a = a;
+  c->b = b;
+  __atomic_store_n(&c->q, q + 2, __ATOMIC_RELEASE);
+}
+
+//
+// True the first time a file is seen in this walk. Hard links are the only
+// way to see one twice so files with a single link are not looked up. When
+// the table is full a file is counted again rather than lost.
+//
+static inline bool
+fm_du_link(struct fm_du *x, const struct stat *st)
+{
+  if (S_ISDIR(st->st_mode) || st->st_nlink < 2) return 1;
+  u64 k = fm_du_hash(st->st_dev, st->st_ino) | 1;
+  for (usize j = 0; j < 16; j++) {
+    u64 *h = &x->h[(k + j) & (DFM_DU_LINKS - 1)];
+    u64 z = 0;
+    if (__atomic_compare_exchange_n(h, &z, k, 0,
+        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      return 1;
+    if (z == k) return 0;
+  }
+  return 1;
+}
+
+static inline void
+fm_du_add(struct fm_du *x, const struct stat *st, u64 *a, u64 *b)
+{
+  if (!fm_du_link(x, st)) return;
+  *a += (u64) st->st_blocks * 512;
+  *b += (u64) st->st_size;
+}
+
+//
+// Sum up the entry s of the working directory. Every directory finished
+// without errors goes into the cache and cached ones are not entered.
+//
+static inline void
+fm_du_tree(struct fm *p, struct fs_prog *g, const char *s, u64 *a, u64 *b)
+{
+  struct fm_du *x = p->dr;
+  struct stat st;
+  struct stat ds[WALK_DEPTH];
+  u64 ta[WALK_DEPTH];
+  u64 tb[WALK_DEPTH];
+  bool te[WALK_DEPTH];
+  struct walk w;
+  if (fstatat(p->dfd, s, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+    fs_prog_err(g, s, errno);
+    return;
+  }
+  if (!S_ISDIR(st.st_mode) || fm_du_cache_get(p->dc, &st, a, b)) {
+    if (!S_ISDIR(st.st_mode)) fm_du_add(x, &st, a, b);
+    return;
+  }
+  if (walk_open(&w, p->dfd, s) < 0) {
+    fs_prog_err(g, s, errno);
+    fm_du_add(x, &st, a, b);
+    return;
+  }
+  ds[0] = st;
+  ta[0] = tb[0] = 0;
+  te[0] = 0;
+  fm_du_add(x, &st, &ta[0], &tb[0]);
+  for (int r; (r = walk_next(&w)); ) {
+    usize d = w.n;
+    if (r != WALK_ENT) {
+      if (r == WALK_ERR) {
+        fs_prog_err(g, w.p, w.e);
+        te[d] = 1;
+      }
+      if (!te[d]) fm_du_cache_put(p->dc, &ds[d], ta[d], tb[d]);
+      if (!d) continue;
+      ta[d - 1] += ta[d];
+      tb[d - 1] += tb[d];
+      te[d - 1] |= te[d];
+      continue;
+    }
+    d--;
+    struct stat es;
+    u64 ca;
+    u64 cb;
+    if (fstatat(walk_dfd(&w), w.p + w.b, &es, AT_SYMLINK_NOFOLLOW) < 0) {
+      fs_prog_err(g, w.p, errno);
+      te[d] = 1;
+    } else if (!S_ISDIR(es.st_mode))
+      fm_du_add(x, &es, &ta[d], &tb[d]);
+    else if (fm_du_cache_get(p->dc, &es, &ca, &cb)) {
+      ta[d] += ca;
+      tb[d] += cb;
+    } else if (walk_push(&w) < 0) {
+      fs_prog_err(g, w.p, errno);
+      te[d] = 1;
+      fm_du_add(x, &es, &ta[d], &tb[d]);
+    } else {
+      d++;
+      ds[d] = es;
+      ta[d] = tb[d] = 0;
+      te[d] = 0;
+      fm_du_add(x, &es, &ta[d], &tb[d]);
+    }
+  }
+  *a = ta[0];
+  *b = tb[0];
+}
+
+static inline void
+fm_du_work(struct fm *p, struct fs_prog *g)
+{
+  struct fm_du *x = p->dr;
+  for (usize j; (j = __atomic_fetch_add(&x->i, 1, __ATOMIC_RELAXED)) < x->n; ) {
+    struct fm_du_unit *u = &x->u[j];
+    fm_du_tree(p, g, p->de + u->o, &u->a, &u->b);
+    __atomic_store_n(&u->s, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&x->d, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&g->nf, 1, __ATOMIC_RELAXED);
+  }
+}
+
+static inline int
+fm_job_du(struct fm *p, struct fs_prog *g)
+{
+  g->tf = p->dr->n;
+  for (usize i = 1; i < DFM_DU_PAR; i++)
+    if (!fork()) {
+      fm_du_work(p, g);
+      _exit(0);
+    }
+  fm_du_work(p, g);
+  while (wait(NULL) > 0 || errno == EINTR);
+  return g->ne ? -1 : 0;
+}
+
+static inline void
+fm_du_apply(struct fm *p, const struct fm_du_unit *u)
+{
+  u64 m = ent_load_off(p, u->o);
+  if (ent_v_geto(p, ent_get(m, LOC), TOMB)) return;
+  u64 s = p->dz == 'b' ? u->b : u->a;
+  ent_set(&m, SIZE, ent_size_encode((off_t) s));
+  ent_store_off(p, u->o, m);
+  fm_row_drop(p, u->o);
+}
+
+static inline void
+fm_du_step(struct fm *p)
+{
+  struct fm_du *x = p->dr;
+  if (p->f & FM_DU || __atomic_load_n(&x->d, __ATOMIC_ACQUIRE) == p->da)
+    return;
+  for (usize j = 0; j < x->n; j++) {
+    struct fm_du_unit *u = &x->u[j];
+    if (__atomic_load_n(&u->s, __ATOMIC_ACQUIRE) != 1) continue;
+    u->s = 2;
+    p->da++;
+    fm_du_apply(p, u);
+  }
+  //
+  // The total is summed again rather than adjusted as the encoded sizes are
+  // too coarse to take a large entry out and a small one in.
+  //
+  u64 n = 0;
+  for (usize i = 0; i < p->dl; i++) {
+    if (ent_v_geto(p, i, TOMB)) continue;
+    u64 m = ent_load(p, i);
+    n += ent_size_bytes(ent_get(m, SIZE), ent_get(m, TYPE));
+  }
+  p->du = ent_size_encode((off_t) n);
+  p->f |= FM_REDRAW_DIR;
+  if (!(p->f & FM_NAV_MSG)) p->f |= FM_REDRAW_NAV;
+  if (p->ds == 's' || p->ds == 'S') p->f |= FM_DIRTY|FM_DIRTY_SIZE;
+}
+
+static inline void
+fm_du_end(struct fm *p)
+{
+  p->dj = 0;
+  fm_du_step(p);
+  fm_du_stop(p);
+}
+
+// }}}
+
+// Job {{{
+
+//
+// File operations run in a forked child so the listing stays usable while
+// they do. The child reports progress through its slot of the fs_prog table
+// which is shared memory, and its exit wakes term_wait() through SIGCHLD.
+//
+static inline int
+fm_job_start(struct fm *p, cut n, fm_job_fn fn)
+{
+  usize i = 0;
+  while (i < DFM_JOB_MAX && p->jb[i].pid) i++;
+  if (i == DFM_JOB_MAX) {
+    fm_draw_err(p, S("too many jobs"), 0);
+    return -1;
+  }
+  struct fs_prog *g = &p->jg[i];
+  g->nb = g->nf = g->tb = g->tf = g->ne = 0;
+  g->e = 0;
+  pid_t pid = fork();
+  if (pid < 0) {
+    fm_draw_err(p, S("fork"), errno);
+    return -1;
+  }
+  if (!pid) {
+    term_signal_child();
+    setpgid(0, 0);
+    _exit(fn(p, g) < 0);
+  }
+  setpgid(pid, pid);
+  p->jb[i].pid = pid;
+  p->jb[i].n = n;
+  p->jb[i].f = fn;
+  p->jn++;
+  p->f |= FM_REDRAW_NAV;
+  return (int) i;
+}
+
+//
+// Failed entries are summed up with the first one that failed rather than
+// given one message each.
+//
+static inline void
+fm_draw_prog_err(struct fm *p, cut n, const struct fs_prog *g, int e)
+{
+  fm_draw_err(p, n.d, n.l, 0);
+  if (g->ne) {
+    STR_PUSH(&p->r.cl, ": ");
+    str_push_u64(&p->r.cl, g->ne);
+    STR_PUSH(&p->r.cl, " failed, first '");
+    str_push_s(&p->r.cl, g->ep);
+    str_push_c(&p->r.cl, '\'');
+    e = e ? e : g->e;
+  }
+  if (!e) return;
+  STR_PUSH(&p->r.cl, ": ");
+  str_push_s(&p->r.cl, strerror(e));
+}
+
+static inline void
+fm_job_done(struct fm *p, usize i, int st)
+{
+  struct fm_job *j = &p->jb[i];
+  const struct fs_prog *g = &p->jg[i];
+  int e = WIFSIGNALED(st) ? ECANCELED : g->e;
+  bool du = j->f == fm_job_du;
+  bool fw = j->f == fm_job_find;
+  if ((du && j->pid != p->dj) || (fw && j->pid != p->fj)) {
+    j->pid = 0;
+    p->jn--;
+    return;
+  }
+  if (du) fm_du_end(p);
+  else if (fw) p->fj = 0;
+  else fm_pane_clear(p);
+  j->pid = 0;
+  p->jn--;
+  p->f |= FM_REDRAW_NAV;
+#ifndef FS_WATCH
+  if (!du && !fw) p->f & FM_FIND ? fm_find_leave(p) : fm_dir_refresh(p);
+#endif
+  if (!e && !g->ne && !(WIFEXITED(st) && WEXITSTATUS(st)))
+    return;
+  if (!p->kd && !p->kp) fm_draw_prog_err(p, j->n, g, e);
+  p->f |= FM_ERROR;
+}
+
+//
+// Reap every child that exited. A job is finished with the status reaped for
+// it, so one that was killed or crashed is never taken for a success.
+//
+static inline void
+fm_job_reap(struct fm *p)
+{
+  int st;
+  for (pid_t r; (r = waitpid(-1, &st, WNOHANG)) > 0; )
+    for (usize i = 0; p->jn && i < DFM_JOB_MAX; i++)
+      if (p->jb[i].pid == r) fm_job_done(p, i, st);
+}
+
+static inline void
+fm_job_step(struct fm *p)
+{
+  if (!p->jn || p->f & FM_NAV_MSG) return;
+  u64 n = fm_clock();
+  if (n - p->jt < DFM_JOB_MS * 1000) return;
+  p->jt = n;
+  p->f |= FM_REDRAW_NAV;
+}
+
+//
+// Start summing up the entries of a listing just loaded in du mode.
+//
+static inline void
+fm_du_start(struct fm *p)
+{
+  p->f &= ~FM_DU;
+  fm_du_stop(p);
+  if (!p->dc) {
+    usize l = sizeof(*p->dc) * DFM_DU_CACHE;
+    void *m = mmap(NULL, l, PROT_READ|PROT_WRITE,
+      MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if (m == MAP_FAILED) {
+      fm_draw_err(p, S("du"), errno);
+      return;
+    }
+    p->dc = m;
+  }
+  usize n = 0;
+  for (usize i = 0; i < p->dl; i++)
+    n += !ent_v_geto(p, i, TOMB) &&
+      !ENT_IS_LNK(ent_get(ent_load(p, i), TYPE));
+  if (!n) return;
+  usize l = sizeof(*p->dr) + n * sizeof(p->dr->u[0]);
+  struct fm_du *x = mmap(NULL, l, PROT_READ|PROT_WRITE,
+    MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if (x == MAP_FAILED) {
+    fm_draw_err(p, S("du"), errno);
+    return;
+  }
+  for (usize i = 0; i < p->dl; i++)
+    if (!ent_v_geto(p, i, TOMB) && !ENT_IS_LNK(ent_get(ent_load(p, i), TYPE)))
+      x->u[x->n++].o = ent_v_geto(p, i, OFF);
+  p->dr = x;
+  p->drl = l;
+  p->da = 0;
+  int j = fm_job_start(p, CUT("du"), fm_job_du);
+  if (j < 0) fm_du_stop(p);
+  else p->dj = p->jb[j].pid;
+}
+
+//
+// The log has room for DFM_FIND_MAX of the longest paths the listing takes,
+// so it never fills up before the result limit is reached.
+//
+static inline int
+fm_find_start(struct fm *p, cut q)
+{
+  if (q.l >= sizeof(p->fq)) {
+    fm_draw_err(p, S("find: pattern too long"), 0);
+    return -1;
+  }
+  if (!fm_path_change(p)) return -1;
+  usize c = DFM_FIND_MAX * ((sizeof(u32) + DFM_NAME_MAX + 4) & ~(usize)3);
+  usize l = sizeof(*p->fr) + c;
+  struct fm_find *x = mmap(NULL, l, PROT_READ|PROT_WRITE,
+    MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if (x == MAP_FAILED) {
+    fm_draw_err(p, S("find"), errno);
+    return -1;
+  }
+  x->c = c;
+  memcpy(p->fq, q.d, q.l);
+  p->fq[q.l] = 0;
+  fm_dir_clear(p);
+  fm_v_rebuild(p);
+  p->fr = x;
+  p->frl = l;
+  p->fc = 0;
+  p->fn = 0;
+  int j = fm_job_start(p, CUT("find"), fm_job_find);
+  if (j < 0) {
+    fm_find_stop(p);
+    return -1;
+  }
+  p->fj = p->jb[j].pid;
+  p->f |= FM_FIND|FM_WALK|FM_REDRAW_DIR|FM_REDRAW_NAV;
+  return 0;
+}
+
+static inline int
+fm_job_cancel(struct fm *p, usize i)
+{
+  pid_t pid = p->jb[i].pid;
+  if (!pid) return -1;
+  return kill(-pid, SIGTERM) < 0 ? kill(pid, SIGTERM) : 0;
+}
+
+typedef void (*fm_job_ent)(struct fm *, struct fs_prog *, int, const char *);
+
+//
+// Marks shared between the processes of a job. Every process goes over the
+// marks in the same order and takes the next one nobody has claimed yet, so
+// a large tree keeps one process busy while the others carry on.
+//
+struct fm_job_share {
+  usize *c;
+  usize n;
+  usize k;
+};
+
+static inline void
+fm_job_call(struct fm *p, struct fs_prog *g, int fd, fm_job_ent fn,
+            struct fm_job_share *s, const char *n)
+{
+  if (s && s->k++ != s->n) return;
+  fn(p, g, fd, n);
+  if (s) s->n = __atomic_fetch_add(s->c, 1, __ATOMIC_RELAXED);
+}
+
+//
+// Call fn on every mark, or on the entry under the cursor when nothing is
+// marked, with the directory holding them open. Marks in the working
+// directory are read from the visible mark bitset as fm_cmd_run does.
+//
+static inline int
+fm_job_each(struct fm *p, struct fs_prog *g, fm_job_ent fn,
+            struct fm_job_share *s)
+{
+  const char *d = p->vml ? p->mpwd.m : p->pwd.m;
+  int fd = open(d, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (fd < 0) {
+    fs_prog_err(g, d, errno);
+    return -1;
+  }
+  if (s) s->n = __atomic_fetch_add(s->c, 1, __ATOMIC_RELAXED);
+  if (!p->vml) {
+    if (p->c != SIZE_MAX) fm_job_call(p, g, fd, fn, s, fm_ent(p, p->c).d);
+  } else if (p->ml) {
+    for (usize i = 0; i < p->ml; i++)
+      fm_job_call(p, g, fd, fn, s, fm_mark_at(p, i).d);
+  } else {
+    for (usize b = 0; b < BITSET_W(p->dl); b++)
+      for (u64 w = p->vm[b] & p->v[b]; w; w &= w - 1) {
+        usize i = (b << 6) + u64_ctz(w);
+        if (i < p->dl) fm_job_call(p, g, fd, fn, s, fm_ent(p, i).d);
+      }
+  }
+  close(fd);
+  return g->ne ? -1 : 0;
+}
+
+//
+// Moving across filesystems copies and a mark is only removed once all of it
+// was copied.
+//
+static inline int
+fm_job_copy_each(struct fm *p, struct fs_prog *g, bool mv)
+{
+  p->cp.g = g;
+  p->rm.g = g;
+  int sfd = open(p->mpwd.m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  int dfd = open(p->pwd.m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (sfd < 0 || dfd < 0) {
+    fs_prog_err(g, sfd < 0 ? p->mpwd.m : p->pwd.m, errno);
+    return -1;
+  }
+  for (usize i = 0; i < p->ml; i++)
+    fs_count(&p->cp.w, g, sfd, fm_mark_at(p, i).d);
+  for (usize i = 0; i < p->ml; i++) {
+    cut m = fm_mark_at(p, i);
+    if (fs_copy(&p->cp, sfd, m.d, dfd, fm_mark_base(m).d) == 0 && mv)
+      fs_remove(&p->rm, sfd, m.d);
+  }
+  close(sfd);
+  close(dfd);
+  return g->ne ? -1 : 0;
+}
+
+static inline int
+fm_job_copy(struct fm *p, struct fs_prog *g)
+{
+  return fm_job_copy_each(p, g, 0);
+}
+
+static inline int
+fm_job_move(struct fm *p, struct fs_prog *g)
+{
+  return fm_job_copy_each(p, g, 1);
+}
+
+//
+// Entries on another filesystem than the trash are copied into it under the
+// name claimed for them and removed once the copy is whole. Entries that are
+// gone were renamed into the trash before the job started.
+//
+static inline void
+fm_job_trash_count(struct fm *p, struct fs_prog *g, int fd, const char *s)
+{
+  fs_count(&p->cp.w, g, fd, s);
+}
+
+static inline void
+fm_job_trash_ent(struct fm *p, struct fs_prog *g, int fd, const char *s)
+{
+  struct trash *t = &p->tr;
+  const str *d = p->vml ? &p->mpwd : &p->pwd;
+  if (trash_claim(t, d->m, d->l, s) < 0) {
+    fs_prog_err(g, s, errno);
+    return;
+  }
+  if (!fs_copy(&p->cp, fd, s, t->f, t->n)) {
+    fs_remove(&p->rm, fd, s);
+    return;
+  }
+  fs_remove(&p->rm, t->f, t->n);
+  trash_unclaim(t);
+}
+
+static inline int
+fm_job_trash(struct fm *p, struct fs_prog *g)
+{
+  p->cp.g = g;
+  p->rm.g = g;
+  fm_job_each(p, g, fm_job_trash_count, NULL);
+  return fm_job_each(p, g, fm_job_trash_ent, NULL);
+}
+
+static inline void
+fm_job_remove_ent(struct fm *p, struct fs_prog *g, int fd, const char *s)
+{
+  (void) g;
+  fs_remove(&p->rm, fd, s);
+}
+
+//
+// Marked trees are removed by DFM_JOB_PAR processes which share the marks
+// and report into the same fs_prog slot.
+//
+static inline int
+fm_job_remove(struct fm *p, struct fs_prog *g)
+{
+  p->rm.g = g;
+  struct fm_job_share s = {0};
+  s.c = mmap(NULL, sizeof(*s.c), PROT_READ|PROT_WRITE,
+    MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if (s.c == MAP_FAILED)
+    return fm_job_each(p, g, fm_job_remove_ent, NULL);
+  for (usize i = 1; i < DFM_JOB_PAR; i++)
+    if (!fork()) _exit(fm_job_each(p, g, fm_job_remove_ent, &s) < 0);
+  fm_job_each(p, g, fm_job_remove_ent, &s);
+  while (wait(NULL) > 0 || errno == EINTR);
+  return g->ne ? -1 : 0;
+}
+
+static inline void
+fm_job_attr_ent(struct fm *p, struct fs_prog *g, int fd, const char *s)
+{
+  (void) g;
+  fs_attr(&p->at, fd, s);
+}
+
+static inline int
+fm_job_attr(struct fm *p, struct fs_prog *g)
+{
+  p->at.g = g;
+  return fm_job_each(p, g, fm_job_attr_ent, NULL);
+}
+
+// }}}
+
+// Command {{{
+
+struct fm_cmd {
+  cut prompt;
+  cut left;
+  cut right;
+  fm_key_press press;
+  fm_key_enter enter;
+  u32 config;
+};
+
+#define FM_CMD(C, ...)                                                         \
+static inline void                                                             \
+C(struct fm *p)                                                                \
+{                                                                              \
+  fm_cmd(p, &(struct fm_cmd){__VA_ARGS__});                                    \
+}
+
+enum {
+  CMD_BG           = 1 << 0,
+  CMD_CONFLICT     = 1 << 1,
+  CMD_MUT          = 1 << 2,
+  CMD_EXEC         = 1 << 3,
+  CMD_MARK_DIR     = 1 << 4,
+  CMD_NOT_MARK_DIR = 1 << 5,
+  CMD_STDIN        = 1 << 6,
+  CMD_FILE_CURSOR  = 1 << 7,
+  CMD_EXEC_MARK    = 1 << 8,
+  CMD_EXEC_ROOT    = 1 << 9,
+  CMD_PAR          = 1 << 10,
+
+  CMD_MODE_EACH    = 0,
+  CMD_MODE_VIRTUAL,
+  CMD_MODE_CHUNK,
+  CMD_MODE_BULK,
+  CMD_MODE_SINGLE,
+};
+
+static inline void
+fm_cmd_exec(struct fm *p)
+{
+  if (p->kd && p->kd(p, &p->r.cl) >= 0 && !(p->f & FM_MSG))
+    rl_clear(&p->r);
+  p->r.vx = 0;
+  p->r.pr.l = 0;
+  p->kp = 0;
+  p->kd = 0;
+}
+
+static inline void
+fm_cmd(struct fm *p, struct fm_cmd *c)
+{
+  if (!c->press && !c->enter) {
+    fm_draw_err(p, S("no callbacks defined"), 0);
+    return;
+  }
+  rl_clear(&p->r);
+  rl_pr_set(&p->r, c->prompt);
+  if (c->left.l) {
+    str_push(&p->r.cl, c->left.d, c->left.l);
+    str_terminate(&p->r.cl);
+  }
+  if (c->right.l) rl_cr_set(&p->r, c->right);
+  if (c->config & CMD_FILE_CURSOR) {
+    if (p->c == SIZE_MAX) return;
+    cut e = fm_ent(p, p->c);
+    str_push(&p->r.cl, e.d, e.l);
+  }
+  rl_cl_sync(&p->r);
+  p->cf = c->config;
+  p->pj = 0;
+  p->kp = c->press;
+  p->kd = c->enter;
+  p->f |= FM_REDRAW_CMD;
+  if (p->f & FM_ROOT && !(p->cf & CMD_EXEC_ROOT))
+    return;
+  if ((p->cf & CMD_EXEC_MARK && p->vml) || p->cf & CMD_EXEC) {
+    rl_join(&p->r);
+    fm_cmd_exec(p);
+  }
+}
+
+static inline void
+fm_cmd_search_press(struct fm *p, int k, cut cl, cut cr)
+{
+  if (cl.l > 1 && k != KEY_BACKSPACE && p->vl != p->dl && !cr.l) {
+    fm_filter_apply_inc(p, p->sf, cl, cr);
+  } else
+    fm_filter_apply(p, p->sf, cl, cr);
+  fm_filter_save(p, cl, cr);
+  fm_cursor_set(p, 0, 0);
+}
+
+static inline int
+fm_cmd_search(struct fm *p, str *s)
+{
+  if (p->vl == 1) fm_open(p);
+  else {
+    if (s->l) {
+      cut q = (cut){ s->m, s->l };
+      fm_filter_apply(p, p->sf, q, CUT_NULL);
+      fm_filter_save(p, q, CUT_NULL);
+    }
+    else
+      fm_filter_apply(p, fm_filter_hidden, (cut){ s->m, s->l }, CUT_NULL);
+    fm_cursor_set(p, 0, 0);
+  }
+  return -1;
+}
+
+static inline int
+fm_cmd_cd(struct fm *p, str *s)
+{
+  int r = 0;
+  if (s->m[0] == '/')
+    r = fm_path_cd(p, s->m, s->l);
+  else
+    r = fm_path_cd_relative(p, s->m, s->l);
+  return r ? 0 : -1;
+}
+
+static inline int
+fm_cmd_find(struct fm *p, str *s)
+{
+  if (!s->l) return 0;
+  return fm_find_start(p, (cut){ s->m, s->l });
+}
+
+static inline int
+fm_cmd_grep(struct fm *p, str *s)
+{
+  if (!s->l) return 0;
+  return fm_grep_start(p, (cut){ s->m, s->l });
+}
+
+static u8
+fm_prompt_conflict(struct fm *p, cut d)
+{
+  fm_draw_nav_begin(p, CUT(DFM_COL_NAV_ERR));
+  STR_PUSH(&p->io, "conflict: '");
+  str_push(&p->io, d.d, d.l);
+  STR_PUSH(&p->io, "': try overwrite?");
+  STR_PUSH(&p->io, " [a]bort [y]es [Y]es all [n]o [N]o all");
+  fm_draw_nav_end(p);
+  fm_draw_flush(p);
+  for (;;) {
+    if (!term_key_read(p->t.fd, &p->k))
+      return 'a';
+    switch (p->k.b[0]) {
+    case 'a': case 'y': case 'Y': case 'n': case 'N':
+      return p->k.b[0];
+    }
+  }
+}
+
+static inline int
+fm_prepare_marks_conflict(struct fm *p)
+{
+  usize i = 0;
+  cut m = CUT_NULL;
+  int om = 0;
+  if (!p->ml) {
+    m = fm_ent(p, p->c);
+    goto c;
+  }
+  for (; i < p->ml; ) {
+    m = fm_mark_at(p, i);
+c:
+    if (!fm_dir_exists(p, fm_mark_base(m))) goto s;
+    if (om != 'Y' && om != 'N')
+      om = fm_prompt_conflict(p, m);
+    switch (om) {
+    case 'a': return -1;
+    case 'y': case 'Y': goto s;
+    case 'n': fm_mark_drop_idx(p, i); om = -2; continue;
+    case 'N': p->ml = 0; return -1;
+    }
+s:
+    i++;
+  }
+  return om;
+}
+
+//
+// Bytes left for marks on a bulk command line once the environment and the
+// rest of the command are accounted for. Strings are counted the way
+// execve() counts them, terminator and pointer included.
+//
+static inline usize
+fm_cmd_arg_max(struct fm *p, cut s, usize ti)
+{
+  extern char **environ;
+  long x = sysconf(_SC_ARG_MAX);
+  usize n = x > 0 ? (usize) x : _POSIX_ARG_MAX;
+  usize u = DFM_ARG_PAD + 2 * sizeof(char *);
+  for (char **e = environ; *e; e++)
+    u += strlen(*e) + 1 + sizeof(char *);
+  cut c;
+  for (usize j = 0, k = 0; next_tok(s.d, s.l, &k, &c); j++) {
+    if (j == ti) continue;
+    if (c.l == 2 && c.d[0] == '%' && c.d[1] == 'd')
+      c.l = p->pwd.l;
+    else if (c.l > 1 && c.d[0] == '$') {
+      const char *e = getenv(c.d + 1);
+      c.l = e ? strlen(e) : 0;
+    }
+    u += c.l + 1 + sizeof(char *);
+  }
+  return n > u ? n - u : 0;
+}
+
+static inline usize
+fm_cmd_par_n(struct fm *p)
+{
+  usize n = p->pj;
+  if (!n) {
+    long c = sysconf(_SC_NPROCESSORS_ONLN);
+    n = c > 0 ? (usize) c : 1;
+  }
+  return MIN(n, DFM_PAR_MAX);
+}
+
+//
+// Next mark at or after i, SIZE_MAX once there are none left.
+//
+static inline usize
+fm_cmd_mark_next(struct fm *p, usize i)
+{
+  if (p->ml) return i < p->ml ? i : SIZE_MAX;
+  for (usize b = i >> 6; b < BITSET_W(p->dl); b++) {
+    u64 w = p->vm[b] & p->v[b];
+    if (b == i >> 6) w &= ~((1ULL << (i & 63)) - 1ULL);
+    if (!w) continue;
+    i = (b << 6) + u64_ctz(w);
+    return i < p->dl ? i : SIZE_MAX;
+  }
+  return SIZE_MAX;
+}
+
+static inline cut
+fm_cmd_mark_name(struct fm *p, usize i)
+{
+  return p->ml ? fm_mark_at(p, i) : fm_ent(p, i);
+}
+
+//
+// Lay out one batch in p->av: the words of the command around as many marks
+// from *k on as fit in a bytes of arguments. *k is left at the next mark.
+//
+static inline char **
+fm_cmd_bulk_argv(struct fm *p, cut s, usize ti, usize tc, usize *k, usize a)
+{
+  usize n = 0;
+  cut c;
+  for (usize j = 0, t = 0; j < tc && next_tok(s.d, s.l, &t, &c); j++) {
+    if (j == ti) {
+      usize u = 0;
+      usize m = 0;
+      usize e = DFM_ARG_MAX - DFM_MARK_CMD_POST - 1;
+      for (; *k != SIZE_MAX; *k = fm_cmd_mark_next(p, *k + 1), m++) {
+        cut x = fm_cmd_mark_name(p, *k);
+        usize l = x.l + 1 + sizeof(char *);
+        if (m && (u + l > a || n == e)) break;
+        p->av[n++] = (char *)x.d;
+        u += l;
+      }
+      p->bn++;
+      p->bm = MAX(p->bm, m);
+      p->bb = MAX(p->bb, u);
+    } else if (c.l == 2 && c.d[0] == '%' && c.d[1] == 'd')
+      p->av[n++] = p->pwd.m;
+    else if (c.l > 1 && c.d[0] == '$') {
+      if (!(p->av[n++] = getenv(c.d + 1))) return NULL;
+    } else
+      p->av[n++] = (char *)c.d;
+  }
+  p->av[n] = NULL;
+  return p->av;
+}
+
+static inline int
+fm_cmd_bulk_wait(struct fm *p, usize j)
+{
+  int st = 0;
+  pid_t pid = p->pr[j].pid;
+  if (!pid) return 0;
+  p->pr[j].pid = 0;
+  while (waitpid(pid, &st, 0) < 0)
+    if (errno != EINTR) return 0;
+  int r = fm_exec_status(p, st);
+  if (r >= 0 && !p->ml) fm_mark_clear_range(p, p->pr[j].i, p->pr[j].l);
+  return r;
+}
+
+//
+// Run one batch. In parallel mode up to fm_cmd_par_n() batches run at once
+// and the oldest is waited for when all slots are taken, which suits
+// commands whose batches do not depend on one another. Each slot keeps the
+// range of marks its batch was given (i up to l) so that only the marks of
+// batches which succeed are cleared once they are waited for.
+//
+static inline int
+fm_cmd_bulk_batch(struct fm *p, cut s, usize ti, usize tc, u32 f, usize *k, usize a)
+{
+  usize j = p->bn % fm_cmd_par_n(p);
+  usize o = *k;
+  int r = f & CMD_PAR ? fm_cmd_bulk_wait(p, j) : 0;
+  char **av = fm_cmd_bulk_argv(p, s, ti, tc, k, a);
+  if (!av) return -2;
+  const char *const *v = (const char *const *)av;
+  const char *wd = p->mpwd.m;
+  if (!(f & CMD_PAR)) {
+    r = fm_exec(p, -1, wd, v, f & CMD_BG, 0);
+    if (r >= 0 && !p->ml) fm_mark_clear_range(p, o, MIN(*k, p->dl));
+    return r;
+  }
+  if (spawn_cmd(f & CMD_BG ? p->t.null : p->t.fd, -1, wd, v, &p->pr[j].pid) < 0) {
+    fm_draw_err(p, S("exec"), errno);
+    return -1;
+  }
+  p->pr[j].i = o;
+  p->pr[j].l = MIN(*k, p->dl);
+  return r;
+}
+
+static inline int
+fm_cmd_bulk_done(struct fm *p, int r)
+{
+  for (usize j = 0; j < DFM_PAR_MAX; j++)
+    if (fm_cmd_bulk_wait(p, j) < 0 && r >= 0) r = -1;
+  return r;
+}
+
+static inline void
+fm_cmd_bulk_stat(struct fm *p)
+{
+  if (p->bn < 2) return;
+  fm_draw_msg(p, S("exec: "));
+  str_push_u64(&p->r.cl, p->bn);
+  STR_PUSH(&p->r.cl, " batches of up to ");
+  str_push_u64(&p->r.cl, p->bm);
+  STR_PUSH(&p->r.cl, " marks, ");
+  ent_size_decode(&p->r.cl, ent_size_encode((off_t)p->bb), 0, ENT_TYPE_MAX);
+  STR_PUSH(&p->r.cl, " of arguments");
+}
+
+//
+// Run the command on the marks in as few batches as the kernel's argument
+// limit allows. Marks in the mark directory are read straight from the
+// listing and cleared once their batch exits successfully.
+//
+static inline int
+fm_cmd_build_bulk(struct fm *p, cut s, usize ti, usize tc, u32 f)
+{
+  int r = 0;
+  usize a = fm_cmd_arg_max(p, s, ti);
+  p->bn = p->bm = p->bb = 0;
+  if (!(f & CMD_BG)) fm_term_cooked(p);
+  for (usize k = fm_cmd_mark_next(p, 0); r >= 0 && k != SIZE_MAX; )
+    r = fm_cmd_bulk_batch(p, s, ti, tc, f, &k, a);
+  r = fm_cmd_bulk_done(p, r);
+  if (!(f & CMD_BG)) fm_term_raw(p);
+  if (r < 0) return r;
+  fm_mark_clear_all(p);
+  fm_cmd_bulk_stat(p);
+  return 0;
+}
+
+static inline const char *const *
+fm_cmd_argv(struct fm *p, cut s, usize ti, usize tc, usize mp, cut mk)
+{
+  char **m = (char **)(void *)p->d.d;
+  usize pri = mp;
+  cut c;
+  for (usize j = 0, n = 0; next_tok(s.d, s.l, &n, &c); j++)
+    if (j == ti)
+      m[pri++] = (char *)mk.d;
+    else if (c.l == 2 && c.d[0] == '%' && c.d[1] == 'd')
+      m[pri++] = p->pwd.m;
+    else if (c.l > 1 && c.d[0] == '$') {
+      char *e = getenv(c.d + 1);
+      if (!e) return NULL;
+      m[pri++] = e;
+    } else
+      m[pri++] = (char *)c.d;
+  m[mp + tc] = NULL;
+  return (const char *const *)&m[mp];
+}
+
+static inline int
+fm_cmd_build(struct fm *p, cut s, usize ti, usize tc, u32 f, usize mp, cut mk, bool t)
+{
+  const char *const *a = fm_cmd_argv(p, s, ti, tc, mp, mk);
+  if (!a) return -2;
+  u32 lf = f;
+  int fd = -1;
+  if (lf & CMD_STDIN) {
+    fd = open(mk.d, O_RDONLY|O_CLOEXEC);
+    if (fd < 0) return -1;
+  }
+  int r = fm_exec(p, fd, p->pwd.m, a, lf & CMD_BG, t);
+  if (fd >= 0) close(fd);
+  return r;
+}
+
+static inline int
+fm_cmd_build_each_virtual(struct fm *p, cut s, usize ti, usize tc, u32 f)
+{
+  cut mk = CUT_NULL;
+  usize mp = p->mp - (tc + 1);
+  if (!p->vml) {
+    if (p->c == SIZE_MAX) return 0;
+    mk = fm_ent(p, p->c);
+    return fm_cmd_build(p, s, ti, tc, f, mp, mk, 1);
+  }
+  if (!(f & CMD_BG)) fm_term_cooked(p);
+  int r = 0;
+  usize nw = BITSET_W(p->dl);
+  for (usize b = 0; b < nw; b++) {
+    for (u64 w = p->vm[b] & p->v[b]; w; ) {
+      usize i = (b << 6) + u64_ctz(w);
+      w &= w - 1;
+      if (i >= p->dl) break;
+      mk = fm_ent(p, i);
+      if (fm_cmd_build(p, s, ti, tc, f, mp, mk, 0) < 0) {
+        r = -1;
+        goto e;
+      }
+      fm_mark_clear_idx(p, i);
+      if (!p->vml) goto e;
+    }
+  }
+e:
+  if (!(f & CMD_BG)) fm_term_raw(p);
+  return r;
+}
+
+static inline int
+fm_cmd_build_each(struct fm *p, cut s, usize ti, usize tc, u32 f)
+{
+  cut mk = CUT_NULL;
+  usize mp = p->mp - (tc + 1);
+  if (!p->vml) {
+    if (p->c == SIZE_MAX) return 0;
+    mk = fm_ent(p, p->c);
+    return fm_cmd_build(p, s, ti, tc, f, mp, mk, 1);
+  }
+  if (!(f & CMD_BG)) fm_term_cooked(p);
+  for (; p->ml; ) {
+    mk = fm_mark_at(p, 0);
+    str fp = p->mpwd;
+    str_push_c(&fp, '/');
+    str_push(&fp, mk.d, mk.l);
+    str_terminate(&fp);
+    mk = (cut) { fp.m, fp.l };
+    if (fm_cmd_build(p, s, ti, tc, f, mp, mk, 0) < 0) {
+      if (!(f & CMD_BG)) fm_term_raw(p);
+      return -1;
+    }
+    fm_mark_pop_first(p);
+    if (p->vml) p->vml--;
+  }
+  if (!(f & CMD_BG)) fm_term_raw(p);
+  return 0;
+}
+
+static inline int
+fm_cmd_par_spawn(struct fm *p, cut s, usize ti, usize tc, usize j, usize i)
+{
+  cut mk = fm_cmd_mark_name(p, i);
+  str fp = p->mpwd;
+  if (p->ml) {
+    str_push_c(&fp, '/');
+    str_push(&fp, mk.d, mk.l);
+    str_terminate(&fp);
+    mk = (cut) { fp.m, fp.l };
+  }
+  const char *const *a = fm_cmd_argv(p, s, ti, tc, p->mp - (tc + 1), mk);
+  if (!a) return -2;
+  int fd[2];
+  if (pipe(fd) < 0) return -1;
+  fcntl(fd[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fd[1], F_SETFD, FD_CLOEXEC);
+  struct fm_par *c = &p->pr[j];
+  int r = spawn_cmd(fd[1], -1, p->pwd.m, a, &c->pid);
+  int e = errno;
+  close(fd[1]);
+  if (r < 0) {
+    close(fd[0]);
+    errno = e;
+    return -1;
+  }
+  c->i = i;
+  c->l = 0;
+  p->pf[j] = (struct pollfd){ .fd = fd[0], .events = POLLIN };
+  return 0;
+}
+
+static inline void
+fm_cmd_par_flush(struct fm *p, struct fm_par *c, u32 f)
+{
+  if (!(f & CMD_BG)) str_push(&p->io, c->b, c->l);
+  c->l = 0;
+}
+
+//
+// A child is done once its end of the pipe is closed. Its output goes out in
+// one piece followed by why it failed, if it did, so nothing interleaves.
+//
+static inline void
+fm_cmd_par_done(struct fm *p, usize j, u32 f, struct fs_prog *g)
+{
+  struct fm_par *c = &p->pr[j];
+  int st = 0;
+  close(p->pf[j].fd);
+  p->pf[j].fd = -1;
+  while (waitpid(c->pid, &st, 0) < 0 && errno == EINTR);
+  c->pid = 0;
+  fm_cmd_par_flush(p, c, f);
+  cut n = fm_cmd_mark_name(p, c->i);
+  if (WIFEXITED(st) && !WEXITSTATUS(st)) {
+    if (!p->ml) fm_mark_clear_idx(p, c->i);
+    return;
+  }
+  fs_prog_err(g, n.d, 0);
+  if (f & CMD_BG) return;
+  str_push(&p->io, n.d, n.l);
+  if (WIFEXITED(st)) {
+    STR_PUSH(&p->io, ": exited ");
+    str_push_u32(&p->io, (u32) WEXITSTATUS(st));
+  } else {
+    STR_PUSH(&p->io, ": killed by signal ");
+    str_push_u32(&p->io, (u32) WTERMSIG(st));
+  }
+  str_push_c(&p->io, '\n');
+}
+
+//
+// Run the command once per mark like fm_cmd_build_each() does, but with up
+// to p->pj of them at a time. Output is read from a pipe per child and held
+// until it exits. Marks in the mark directory are cleared as their command
+// succeeds, the failed ones stay marked.
+//
+static inline int
+fm_cmd_build_par(struct fm *p, cut s, usize ti, usize tc, u32 f)
+{
+  usize n = fm_cmd_par_n(p);
+  struct fs_prog g = {0};
+  usize k = fm_cmd_mark_next(p, 0);
+  usize r = 0;
+  int e = 0;
+  for (usize j = 0; j < n; j++) p->pf[j].fd = -1;
+  if (!(f & CMD_BG)) fm_term_cooked(p);
   for (;;) {
-    if (!term_key_read(p->t.fd, &p->k))
-      return 'a';
-    switch (p->k.b[0]) {
-    case 'a': case 'y': case 'Y': case 'n': case 'N':
-      return p->k.b[0];
+    for (usize j = 0; !e && r < n && k != SIZE_MAX && j < n; j++) {
+      if (p->pf[j].fd >= 0) continue;
+      e = fm_cmd_par_spawn(p, s, ti, tc, j, k);
+      if (e == -1) fs_prog_err(&g, fm_cmd_mark_name(p, k).d, errno);
+      e = e == -2 ? -2 : 0;
+      r += p->pf[j].fd >= 0;
+      k = fm_cmd_mark_next(p, k + 1);
+    }
+    if (!r) break;
+    if (poll(p->pf, (nfds_t) n, -1) < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (usize j = 0; j < n; j++) {
+      if (p->pf[j].fd < 0 || !p->pf[j].revents) continue;
+      struct fm_par *c = &p->pr[j];
+      ssize_t l = read(p->pf[j].fd, c->b + c->l, sizeof(c->b) - c->l);
+      if (l < 0 && errno == EINTR) continue;
+      if (l > 0) {
+        c->l += (usize) l;
+        if (c->l == sizeof(c->b)) fm_cmd_par_flush(p, c, f);
+        continue;
+      }
+      fm_cmd_par_done(p, j, f, &g);
+      r--;
+    }
+    if (!(f & CMD_BG)) p->io.f(&p->io, p, 0);
+  }
+  if (!(f & CMD_BG)) fm_term_raw(p);
+  if (e == -2) return -2;
+  if (!g.ne) {
+    fm_mark_clear_all(p);
+    return 0;
+  }
+  fm_draw_prog_err(p, CUT("exec"), &g, 0);
+  return -1;
+}
+
+static inline int
+fm_cmd_sh(struct fm *p, cut c)
+{
+  if (!c.l) return 0;
+  cut f = !p->ml && p->c != SIZE_MAX ? fm_ent(p, p->c) : CUT_NULL;
+  cut sh = get_env("SHELL", "/bin/sh");
+  const char *cmd[] = { sh.d, DFM_SHELL_OPTS, c.d, CFG_NAME, f.d, NULL };
+  STATIC_ASSERT(ARR_SIZE(cmd) < DFM_MARK_CMD_PRE, "");
+  usize l = ARR_SIZE(cmd) - (!f.l * 2);
+  char **m = (char **)(void *)p->d.d;
+  char **a = &m[p->mp - l];
+  memcpy(a, cmd, sizeof(*cmd) * l);
+  if (!f.l) a[l + p->ml] = NULL;
+  int r =
+    fm_exec(p, -1, f.l ? p->pwd.m : p->mpwd.m, (const char *const *)a, 0, 1);
+  if (!f.l) fm_mark_clear_all(p);
+  if (r < 0) p->f |= FM_ERROR;
+  return r;
+}
+
+static inline int
+fm_cmd_run_sh(struct fm *p, str *s)
+{
+  if (fm_mark_materialize(p) < 0) {
+    fm_draw_err(p, S("not enough memory to materialize marks"), 0);
+    return -1;
+  }
+  usize e = s->m[0] == '!';
+  return fm_cmd_sh(p, (cut){ s->m + e, s->l - e });
+}
+
+static inline void
+fm_cmd_mut(struct fm *p)
+{
+  fm_pane_clear(p);
+#ifdef FS_WATCH
+  p->f |= FM_DIRTY_WITHIN;
+#else
+  p->f & FM_FIND ? fm_find_leave(p) : fm_dir_refresh(p);
+#endif
+}
+
+static inline void
+fm_journal_end(struct fm *p)
+{
+  if (journal_end(&p->jr) < 0)
+    fm_draw_err(p, S("journal"), errno);
+}
+
+static inline cut
+fm_cmd_parse(struct fm *p, str *s, usize *oti, usize *ott, usize *otc)
+{
+  cut c;
+  usize tc = 0;
+  usize ti = SIZE_MAX;
+  usize tt = 0;
+  usize li = 0;
+  cut lt = CUT_NULL;
+  for (usize i = 0, n = 0; next_tok(s->m, s->l, &n, &c); i++, tc++) {
+    ((char *)c.d)[c.l] = 0;
+    lt = c;
+    li = i;
+    if (ti == SIZE_MAX && c.l == 2 && c.d[0] == '%') {
+      if (c.d[1] == 'm' || c.d[1] == 'f' ) {
+        ti = i;
+        tt = c.d[1];
+      }
+    }
+  }
+  usize j = 1;
+  usize pj = 0;
+  for (; j < lt.l && lt.d[j] >= '0' && lt.d[j] <= '9'; j++)
+    pj = MIN(pj * 10 + (usize)(lt.d[j] - '0'), DFM_PAR_MAX);
+  if (tc && lt.l && lt.d[0] == '&' && j == lt.l) {
+    p->cf |= lt.l == 1 ? CMD_BG : CMD_PAR;
+    p->pj = pj;
+    tc--;
+    if (ti != SIZE_MAX && li < ti) ti--;
+  }
+  *oti = ti;
+  *ott = tt;
+  *otc = tc;
+  c = (cut){ s->m, s->l };
+  switch (s->m[0]) {
+    case '<': c.d++; c.l--; p->cf |= CMD_STDIN; break;
+  }
+  return c;
+}
+
+static inline int
+fm_cmd_run(struct fm *p, str *s)
+{
+  int m = CMD_MODE_SINGLE;
+  int r = 0;
+  if (!s->l) return 0;
+  if (p->cf & CMD_MARK_DIR && !(p->f & FM_MARK_PWD) && p->vml) {
+    fm_draw_err(p, S("not in mark directory"), 0);
+    return -1;
+  }
+  if (p->cf & CMD_NOT_MARK_DIR && p->f & FM_MARK_PWD) {
+    fm_draw_err(p, S("in mark directory"), 0);
+    return -1;
+  }
+  if (s->m[0] == '!')
+    return fm_cmd_run_sh(p, s);
+  usize ti;
+  usize tt;
+  usize tc;
+  cut a = fm_cmd_parse(p, s, &ti, &tt, &tc);
+  if ((tt && (!p->vml && !p->vl))) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  if (p->cf & (CMD_STDIN|CMD_FILE_CURSOR))
+    m = CMD_MODE_SINGLE;
+  else if (tt == 'm') {
+    m = p->f & FM_MARK_PWD ? CMD_MODE_CHUNK : CMD_MODE_BULK;
+    m = p->vml ? m : CMD_MODE_EACH;
+  } else if (tt == 'f')
+    m = p->f & FM_MARK_PWD ? CMD_MODE_VIRTUAL : CMD_MODE_EACH;
+  if (p->cf & CMD_PAR && m == CMD_MODE_SINGLE) {
+    fm_draw_err(p, S("&N needs %f or %m"), 0);
+    return -1;
+  }
+  switch (m) {
+  case CMD_MODE_SINGLE:
+  case CMD_MODE_EACH:
+  case CMD_MODE_VIRTUAL:
+    if (tc > DFM_MARK_CMD_PRE) {
+      fm_draw_err(p, S("argv too large"), 0);
+      return -1;
+    }
+    break;
+  case CMD_MODE_BULK:
+  case CMD_MODE_CHUNK:
+    if (ti > DFM_MARK_CMD_PRE || tc - ti - 1 > DFM_MARK_CMD_POST) {
+      fm_draw_err(p, S("argv too large"), 0);
+      return -1;
+    }
+  }
+  switch (m) {
+  case CMD_MODE_EACH:
+  case CMD_MODE_BULK:
+    if (p->cf & CMD_CONFLICT) {
+      r = fm_prepare_marks_conflict(p);
+      if (r < 0) p->f |= FM_REDRAW_NAV;
+      if (r == -1) return 0;
+      if (r == -2 && !p->ml) return 0;
     }
+    break;
+  }
+  cut mk = CUT_NULL;
+  switch (m) {
+  case CMD_MODE_SINGLE:
+    if (p->c != SIZE_MAX)
+      mk = fm_ent(p, p->c);
+    r = fm_cmd_build(p, a, ti, tc, p->cf, p->mp - (tc + 1), mk, 1);
+    break;
+  case CMD_MODE_EACH:
+  case CMD_MODE_VIRTUAL:
+    if (p->cf & CMD_PAR && p->vml)
+      r = fm_cmd_build_par(p, a, ti, tc, p->cf);
+    else if (m == CMD_MODE_EACH)
+      r = fm_cmd_build_each(p, a, ti, tc, p->cf);
+    else
+      r = fm_cmd_build_each_virtual(p, a, ti, tc, p->cf);
+    break;
+  case CMD_MODE_BULK:
+  case CMD_MODE_CHUNK:
+    r = fm_cmd_build_bulk(p, a, ti, tc, p->cf);
+    break;
+  }
+  if (r != -1 && p->cf & CMD_MUT)
+    fm_cmd_mut(p);
+  if (r == -2)
+    fm_draw_err(p, S("environment variable unset"), 0);
+  if (r < 0) p->f |= FM_ERROR;
+  return r;
+}
+
+//
+// Get marks from another directory ready to be brought into the working
+// directory. Returns 1 when there is something left to do after conflicts
+// have been resolved.
+//
+static inline int
+fm_cmd_marks_here(struct fm *p)
+{
+  if (p->f & FM_MARK_PWD) {
+    fm_draw_err(p, S("in mark directory"), 0);
+    return -1;
+  }
+  if (!p->vml) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  if (fm_mark_materialize(p) < 0) {
+    fm_draw_err(p, S("not enough memory to materialize marks"), 0);
+    return -1;
+  }
+  if (p->cf & CMD_CONFLICT) {
+    int r = fm_prepare_marks_conflict(p);
+    if (r < 0) p->f |= FM_REDRAW_NAV;
+    if (r == -1 || !p->ml) return 0;
+  }
+  return 1;
+}
+
+//
+// Copy the marks into the working directory in a background job. The command
+// line is not used, the marks and the working directory are the only operands.
+//
+static inline int
+fm_cmd_copy(struct fm *p, str *s)
+{
+  (void) s;
+  int r = fm_cmd_marks_here(p);
+  if (r <= 0) return r;
+  if (fm_job_start(p, CUT("copy"), fm_job_copy) < 0)
+    return -1;
+  fm_mark_clear_all(p);
+  return 0;
+}
+
+//
+// Move the marks into the working directory. Each is renamed in place, one
+// system call and no process, and only marks on another filesystem are left
+// to a background job that copies and then removes them. Marks that did not
+// conflict when the listing was checked are renamed without replacing so a
+// file that appeared since is never clobbered.
+//
+static inline int
+fm_cmd_move(struct fm *p, str *s)
+{
+  (void) s;
+  int r = fm_cmd_marks_here(p);
+  if (r <= 0) return r;
+  struct fs_prog g = {0};
+  int sfd = open(p->mpwd.m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  int dfd = open(p->pwd.m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  bool o = sfd >= 0 && dfd >= 0;
+  if (!o)
+    fs_prog_err(&g, sfd < 0 ? p->mpwd.m : p->pwd.m, errno);
+  journal_begin(&p->jr, JOURNAL_RENAME, p->mpwd.m, p->pwd.m);
+  for (usize i = 0; o && i < p->ml; ) {
+    cut m = fm_mark_at(p, i);
+    cut b = fm_mark_base(m);
+    if (fs_rename(sfd, m.d, dfd, b.d, !fm_dir_exists(p, b)) < 0) {
+      if (errno == EXDEV) {
+        i++;
+        continue;
+      }
+      fs_prog_err(&g, m.d, errno);
+    } else
+      journal_add(&p->jr, m.d, b.d);
+    fm_mark_drop_idx(p, i);
+  }
+  fm_journal_end(p);
+  if (sfd >= 0) close(sfd);
+  if (dfd >= 0) close(dfd);
+  fm_cmd_mut(p);
+  if (o && p->ml && fm_job_start(p, CUT("move"), fm_job_move) < 0)
+    return -1;
+  fm_mark_clear_all(p);
+  if (!g.ne) return 0;
+  fm_draw_prog_err(p, CUT("move"), &g, 0);
+  return -1;
+}
+
+//
+// Remove the marks, or the entry under the cursor, in a background job.
+//
+static inline int
+fm_cmd_remove(struct fm *p, str *s)
+{
+  (void) s;
+  if (p->vml && !(p->f & FM_MARK_PWD)) {
+    fm_draw_err(p, S("not in mark directory"), 0);
+    return -1;
+  }
+  if (!p->vml && p->c == SIZE_MAX) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  if (fm_job_start(p, CUT("remove"), fm_job_remove) < 0)
+    return -1;
+  fm_mark_clear_all(p);
+  return 0;
+}
+
+//
+// The home trash, or the one at the top of the mount holding 'd' when the
+// home trash lives on another filesystem. When that cannot be had either the
+// home trash is used and entries are copied into it.
+//
+static inline int
+fm_trash_open(struct fm *p, const char *d, usize l)
+{
+  struct trash *t = &p->tr;
+  struct stat st;
+  char h[PATH_MAX];
+  if (stat(d, &st) < 0 || trash_home(h, sizeof(h)) < 0)
+    return -1;
+  if (!trash_open(t, h) && t->dev == st.st_dev)
+    return 0;
+  trash_close(t);
+  if (!trash_open_top(t, d, l, st.st_dev))
+    return 0;
+  return trash_open(t, h);
+}
+
+//
+// Returns 1 when the entry has to be copied into the trash.
+//
+static inline int
+fm_trash_ent(struct fm *p, struct fs_prog *g, int fd, const char *s)
+{
+  const str *d = p->vml ? &p->mpwd : &p->pwd;
+  if (!trash_put(&p->tr, fd, d->m, d->l, s)) {
+    journal_add(&p->jr, s, p->tr.n);
+    return 0;
   }
+  if (errno == EXDEV)
+    return 1;
+  fs_prog_err(g, s, errno);
+  return 0;
 }
 
+//
+// Trash the marks, or the entry under the cursor, by renaming each into the
+// freedesktop trash. All of them share one deletion time. Whatever is on
+// another filesystem than the trash is left to a background job.
+//
 static inline int
-fm_prepare_marks_conflict(struct fm *p)
+fm_cmd_trash(struct fm *p, str *s)
 {
-  usize i = 0;
-  cut m = CUT_NULL;
-  int om = 0;
-  if (!p->ml) {
-    m = fm_ent(p, p->c);
-    goto c;
+  (void) s;
+  if (p->vml && !(p->f & FM_MARK_PWD)) {
+    fm_draw_err(p, S("not in mark directory"), 0);
+    return -1;
   }
-  for (; i < p->ml; ) {
-    m = fm_mark_at(p, i);
-c:
-    if (!fm_dir_exists(p, m)) goto s;
-    if (om != 'Y' && om != 'N')
-      om = fm_prompt_conflict(p, m);
-    switch (om) {
-    case 'a': return -1;
-    case 'y': case 'Y': goto s;
-    case 'n': fm_mark_drop_idx(p, i); om = -2; continue;
-    case 'N': p->ml = 0; return -1;
+  if (!p->vml && p->c == SIZE_MAX) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  const str *d = p->vml ? &p->mpwd : &p->pwd;
+  if (fm_trash_open(p, d->m, d->l) < 0) {
+    fm_draw_err(p, S("trash"), errno);
+    return -1;
+  }
+  struct fs_prog g = {0};
+  usize x = 0;
+  int fd = open(d->m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  journal_begin(&p->jr, JOURNAL_TRASH, d->m, p->tr.p);
+  if (fd < 0)
+    fs_prog_err(&g, d->m, errno);
+  else if (!p->vml)
+    x = (usize) fm_trash_ent(p, &g, fd, fm_ent(p, p->c).d);
+  else if (p->ml) {
+    for (usize i = 0; i < p->ml; ) {
+      if (!fm_trash_ent(p, &g, fd, fm_mark_at(p, i).d)) {
+        fm_mark_drop_idx(p, i);
+        continue;
+      }
+      i++;
+      x++;
     }
-s:
-    i++;
+  } else {
+    for (usize b = 0; b < BITSET_W(p->dl); b++)
+      for (u64 w = p->vm[b] & p->v[b]; w; w &= w - 1) {
+        usize i = (b << 6) + u64_ctz(w);
+        if (i >= p->dl) continue;
+        if (fm_trash_ent(p, &g, fd, fm_ent(p, i).d)) x++;
+        else fm_mark_clear_idx(p, i);
+      }
   }
-  return om;
+  if (fd >= 0) close(fd);
+  fm_journal_end(p);
+  fm_cmd_mut(p);
+  int r = x ? fm_job_start(p, CUT("trash"), fm_job_trash) : 0;
+  trash_close(&p->tr);
+  if (r < 0) return -1;
+  fm_mark_clear_all(p);
+  if (!g.ne) return 0;
+  fm_draw_prog_err(p, CUT("trash"), &g, 0);
+  return -1;
 }
 
-static inline int
-fm_cmd_build_bulk_exec(struct fm *p, cut s, usize ti, usize tc, u32 f)
+enum {
+  REN_MV  = 0 << 16,
+  REN_TMP = 1 << 16,
+  REN_OUT = 2 << 16,
+};
+
+#define REN_NONE 0xFFFF
+
+static inline void
+fm_ren_add(struct fm *p, usize e, usize *n)
 {
-  usize omi = ti;
-  usize prn = ti;
-  usize pon = (tc - omi - 1);
-  usize tt  = prn + p->ml + pon;
-  usize pri = p->mp - prn;
-  usize poi = p->mp + p->ml;
-  char **m = (char **)(void *)p->d.d;
-  cut c;
-  for (usize i = 0, n = 0; next_tok(s.d, s.l, &n, &c); i++) {
-    if (i == omi) {
-      if (p->ml) continue;
-      cut e = fm_ent(p, p->c);
-      c = e;
-    } else if (c.l == 2 && c.d[0] == '%' && c.d[1] == 'd')
-      c = (cut) { p->pwd.m, p->pwd.l };
-    else if (c.l > 1 && c.d[0] == '$') {
-      c.d = getenv(c.d + 1);
-      if (!c.d) return -2;
+  p->rx[e] = (u16) *n;
+  p->rn[(*n)++] = (struct fm_ren){ .e = (u16) e, .n = REN_NONE, .q = REN_NONE };
+}
+
+//
+// Gather the marks, or the entry under the cursor, as listing entries. rx
+// maps each entry back to its rename.
+//
+static inline usize
+fm_ren_load(struct fm *p)
+{
+  usize n = 0;
+  memset(p->rx, 0xFF, p->dl * sizeof(*p->rx));
+  if (!p->vml)
+    fm_ren_add(p, p->c, &n);
+  else if (p->ml) {
+    for (usize i = 0; i < p->ml; i++) {
+      u16 e;
+      fm_dir_ht_find(p, fm_mark_at(p, i), &e);
+      if (e != 0xFFFF && p->rx[e] == REN_NONE) fm_ren_add(p, e, &n);
     }
-    m[i < ti ? pri++ : poi++] = (char *)c.d;
+  } else {
+    for (usize b = 0; b < BITSET_W(p->dl); b++)
+      for (u64 w = p->vm[b] & p->v[b]; w; w &= w - 1) {
+        usize i = (b << 6) + u64_ctz(w);
+        if (i < p->dl) fm_ren_add(p, i, &n);
+      }
   }
-  char **a = &m[p->mp - prn];
-  a[tt] = NULL;
-  const char *wd = p->mpwd.m;
-  return fm_exec(p, -1, wd, (const char *const *)a, f & CMD_BG, !(f & CMD_BG));
+  return n;
 }
 
 static inline int
-fm_cmd_build_bulk_chunk(struct fm *p, cut s, usize ti, usize tc, u32 f)
+fm_ren_write(struct fm *p, int fd, usize n)
+{
+  char b[8192];
+  usize l = 0;
+  for (usize i = 0; i < n; i++) {
+    cut c = fm_ent(p, p->rn[i].e);
+    if (memchr(c.d, '\n', c.l)) return -2;
+    if (l + c.l + 1 > sizeof(b)) {
+      if (write_all(fd, b, l) < 0) return -1;
+      l = 0;
+    }
+    memcpy(b + l, c.d, c.l);
+    l += c.l;
+    b[l++] = '\n';
+  }
+  return write_all(fd, b, l);
+}
+
+//
+// Read the edited names into a private mapping whose newlines become
+// terminators. Returns the number of lines.
+//
+static inline usize
+fm_ren_read(struct fm *p, int fd, usize n, char **o, usize *ol)
 {
-  int r = 0;
-  usize b = 0;
-  while (b < p->dl && p->vml) {
-    fm_mark_invalidate(p);
-    usize pb = b;
-    usize n = fm_mark_materialize_range(p, &b);
-    if (!n) break;
-    r = fm_cmd_build_bulk_exec(p, s, ti, tc, f);
-    if (r < 0) return r;
-    fm_mark_clear_range(p, pb, b);
-  }
-  if (!p->vml) fm_mark_clear_all(p);
-  return r;
+  struct stat st;
+  if (fstat(fd, &st) < 0) return SIZE_MAX;
+  usize l = (usize) st.st_size;
+  char *m = mmap(NULL, l + 1, PROT_READ|PROT_WRITE,
+    MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (m == MAP_FAILED) return SIZE_MAX;
+  *o = m;
+  *ol = l + 1;
+  for (usize r = 0; r < l; ) {
+    ssize_t x = read(fd, m + r, l - r);
+    if (x > 0) r += (usize) x;
+    else if (!x) l = r;
+    else if (errno != EINTR) return SIZE_MAX;
+  }
+  usize k = 0;
+  for (usize i = 0; i < l; k++) {
+    char *e = memchr(m + i, '\n', l - i);
+    usize j = e ? (usize)(e - m) : l;
+    m[j] = 0;
+    if (k < n) p->rn[k].d = (cut){ m + i, j - i };
+    i = j + 1;
+  }
+  return k;
+}
+
+//
+// Write the names to a temporary file, let $EDITOR loose on it and read it
+// back. Returns the number of lines or SIZE_MAX on error.
+//
+static inline usize
+fm_ren_edit(struct fm *p, usize n, char **m, usize *ml)
+{
+  char f[PATH_MAX];
+  snprintf(f, sizeof(f), "%s/.dfm-brn-XXXXXX", get_env("TMPDIR", "/tmp").d);
+  const char *const a[] = { get_env("EDITOR", DFM_EDITOR).d, f, NULL };
+  usize l = SIZE_MAX;
+  int fd = mkstemp(f);
+  if (fd < 0) {
+    fm_draw_err(p, S("rename"), errno);
+    return l;
+  }
+  int r = fm_ren_write(p, fd, n);
+  close(fd);
+  fd = -1;
+  if (r == -2)
+    fm_draw_err(p, S("rename: name contains a newline"), 0);
+  else if (r < 0)
+    fm_draw_err(p, S("rename"), errno);
+  else if (fm_exec(p, -1, NULL, a, 0, 1) < 0)
+    ;
+  else if ((fd = open(f, O_RDONLY|O_CLOEXEC)) < 0 ||
+      (l = fm_ren_read(p, fd, n, m, ml)) == SIZE_MAX)
+    fm_draw_err(p, S("rename"), errno);
+  if (fd >= 0) close(fd);
+  unlink(f);
+  return l;
 }
 
 static inline int
-fm_cmd_build_bulk(struct fm *p, cut s, usize ti, usize tc, u32 f)
+fm_ren_err(struct fm *p, cut c, const char *m)
 {
-  if (fm_mark_materialize(p) < 0) {
-    fm_draw_err(p, S("not enough memory to materialize marks"), 0);
-    return -1;
+  fm_draw_err(p, S("rename: '"), 0);
+  str_push_sanitize(&p->r.cl, c.d, c.l);
+  STR_PUSH(&p->r.cl, "' ");
+  str_push_s(&p->r.cl, m);
+  return -1;
+}
+
+//
+// Find a target two lines share. The step table is free until the plan is
+// made and serves as an open addressed set of the lines.
+//
+static inline int
+fm_ren_dup(struct fm *p, usize n)
+{
+  usize c = 64;
+  while (c < n * 2) c <<= 1;
+  memset(p->rs, 0, c * sizeof(*p->rs));
+  for (usize i = 0; i < n; i++) {
+    cut d = p->rn[i].d;
+    if (!d.l) continue;
+    usize h = hash_fnv1a32(d.d, d.l) & (c - 1);
+    for (; p->rs[h]; h = (h + 1) & (c - 1))
+      if (cut_cmp(p->rn[p->rs[h] - 1].d, d))
+        return fm_ren_err(p, d, "is given twice");
+    p->rs[h] = (u32) i + 1;
   }
-  if (fm_cmd_build_bulk_exec(p, s, ti, tc, f) < 0)
-    return -1;
-  fm_mark_clear_all(p);
   return 0;
 }
 
+//
+// Point each rename whose target is another's source at it so it runs after
+// it. Unchanged lines are dropped. A target that exists and is not being
+// renamed away, or that two lines share, fails the whole batch.
+//
 static inline int
-fm_cmd_build(struct fm *p, cut s, usize ti, usize tc, u32 f, usize mp, cut mk, bool t)
+fm_ren_link(struct fm *p, usize n)
 {
-  char **m = (char **)(void *)p->d.d;
-  usize pri = mp;
-  cut c;
-  for (usize j = 0, n = 0; next_tok(s.d, s.l, &n, &c); j++)
-    if (j == ti)
-      m[pri++] = (char *)mk.d;
-    else if (c.l == 2 && c.d[0] == '%' && c.d[1] == 'd')
-      m[pri++] = p->pwd.m;
-    else if (c.l > 1 && c.d[0] == '$') {
-      char *e = getenv(c.d + 1);
-      if (!e) return -2;
-      m[pri++] = e;
-    } else
-      m[pri++] = (char *)c.d;
-  u32 lf = f;
-  m[mp + tc] = NULL;
-  int fd = -1;
-  if (lf & CMD_STDIN) {
-    fd = open(mk.d, O_RDONLY|O_CLOEXEC);
-    if (fd < 0) return -1;
+  for (usize i = 0; i < n; i++) {
+    struct fm_ren *r = &p->rn[i];
+    cut o = fm_ent(p, r->e);
+    if (!r->d.l) return fm_ren_err(p, o, "has an empty name");
+    if (cut_cmp(o, r->d)) r->d = CUT_NULL;
   }
-  int r = fm_exec(p, fd, p->pwd.m, (const char *const *)&m[mp], lf & CMD_BG, t);
-  if (fd >= 0) close(fd);
-  return r;
+  if (fm_ren_dup(p, n) < 0) return -1;
+  for (usize i = 0; i < n; i++) {
+    struct fm_ren *r = &p->rn[i];
+    u16 e;
+    if (!r->d.l) continue;
+    fm_dir_ht_find(p, r->d, &e);
+    if (e == 0xFFFF) continue;
+    u16 j = p->rx[e];
+    if (j == REN_NONE || !p->rn[j].d.l)
+      return fm_ren_err(p, r->d, "exists");
+    if (p->rn[j].q != REN_NONE)
+      return fm_ren_err(p, r->d, "is given twice");
+    p->rn[j].q = (u16) i;
+    r->n = j;
+  }
+  return 0;
+}
+
+//
+// Order the renames so each target is free by the time it is used. Every
+// rename has at most one other waiting on it, so they form chains, run from
+// the one with a free target back along their sources, and cycles, broken by
+// parking one source under a temporary name. Returns the number of steps.
+//
+static inline usize
+fm_ren_plan(struct fm *p, usize n, usize *c)
+{
+  usize k = 0;
+  *c = 0;
+  for (usize i = 0; i < n; i++) {
+    if (!p->rn[i].d.l || p->rn[i].n != REN_NONE) continue;
+    for (u16 j = (u16) i; j != REN_NONE; j = p->rn[j].q) {
+      p->rs[k++] = j | REN_MV;
+      p->rn[j].x = 1;
+    }
+  }
+  for (usize i = 0; i < n; i++) {
+    if (!p->rn[i].d.l || p->rn[i].x) continue;
+    p->rs[k++] = (u32) i | REN_TMP;
+    for (u16 j = p->rn[i].q; j != i; j = p->rn[j].q) {
+      p->rs[k++] = j | REN_MV;
+      p->rn[j].x = 1;
+    }
+    p->rs[k++] = (u32) i | REN_OUT;
+    p->rn[i].x = 1;
+    (*c)++;
+  }
+  return k;
 }
 
 static inline int
-fm_cmd_build_each_virtual(struct fm *p, cut s, usize ti, usize tc, u32 f)
+fm_ren_tmp(int fd, const char *s, char *t, usize l)
 {
-  cut mk = CUT_NULL;
-  usize mp = p->mp - (tc + 1);
-  if (!p->vml) {
-    if (p->c == SIZE_MAX) return 0;
-    mk = fm_ent(p, p->c);
-    return fm_cmd_build(p, s, ti, tc, f, mp, mk, 1);
+  for (unsigned i = 0; i < 64; i++) {
+    snprintf(t, l, ".dfm-brn-%ld-%u", (long) getpid(), i);
+    if (!fs_rename(fd, s, fd, t, 1)) return 0;
+    if (errno != EEXIST) break;
   }
-  if (!(f & CMD_BG)) fm_term_cooked(p);
-  int r = 0;
-  usize nw = BITSET_W(p->dl);
-  for (usize b = 0; b < nw; b++) {
-    for (u64 w = p->vm[b] & p->v[b]; w; ) {
-      usize i = (b << 6) + u64_ctz(w);
-      w &= w - 1;
-      if (i >= p->dl) break;
-      mk = fm_ent(p, i);
-      if (fm_cmd_build(p, s, ti, tc, f, mp, mk, 0) < 0) {
-        r = -1;
-        goto e;
-      }
-      fm_mark_clear_idx(p, i);
-      if (!p->vml) goto e;
+  return -1;
+}
+
+static inline void
+fm_ren_run(struct fm *p, int fd, usize k, struct fs_prog *g)
+{
+  char t[64] = "";
+  for (usize s = 0; s < k; s++) {
+    struct fm_ren *r = &p->rn[p->rs[s] & 0xFFFF];
+    const char *o = fm_ent(p, r->e).d;
+    switch (p->rs[s] & ~0xFFFFu) {
+    case REN_MV:
+      if (fs_rename(fd, o, fd, r->d.d, 1) < 0)
+        fs_prog_err(g, o, errno);
+      else
+        journal_add(&p->jr, o, r->d.d);
+      break;
+    case REN_TMP:
+      if (fm_ren_tmp(fd, o, t, sizeof(t)) < 0) {
+        fs_prog_err(g, o, errno);
+        t[0] = 0;
+      } else
+        journal_add(&p->jr, o, t);
+      break;
+    case REN_OUT:
+      if (!t[0]) break;
+      if (fs_rename(fd, t, fd, r->d.d, 1) < 0) {
+        //
+        // The cycle has most likely taken o by now, in which case the entry
+        // stays under its temporary name and the error has to say so.
+        //
+        int e = errno;
+        if (!fs_rename(fd, t, fd, o, 1)) {
+          journal_add(&p->jr, t, o);
+          fs_prog_err(g, o, e);
+        } else
+          fs_prog_err(g, t, e);
+      } else
+        journal_add(&p->jr, t, r->d.d);
+      break;
+    }
+  }
+}
+
+static inline void
+fm_ren_push(struct fm *p, u32 s)
+{
+  struct fm_ren *r = &p->rn[s & 0xFFFF];
+  cut o = fm_ent(p, r->e);
+  if (s & REN_OUT) STR_PUSH(&p->io, "(temporary)");
+  else str_push_sanitize(&p->io, o.d, o.l);
+  STR_PUSH(&p->io, " -> ");
+  if (s & REN_TMP) STR_PUSH(&p->io, "(temporary)");
+  else str_push_sanitize(&p->io, r->d.d, r->d.l);
+}
+
+//
+// Show the steps in place of the listing, in the order they will run, and
+// ask whether to go ahead.
+//
+static u8
+fm_prompt_rename(struct fm *p, usize k, usize c)
+{
+  for (usize i = 0; i < p->row; i++) {
+    vt_cup(&p->io, 1, i + 1);
+    if (i < k) fm_ren_push(p, p->rs[i]);
+    STR_PUSH(&p->io, VT_EL0);
+  }
+  fm_draw_nav_begin(p, CUT(DFM_COL_NAV_CMD));
+  STR_PUSH(&p->io, "rename ");
+  str_push_u64(&p->io, k - c);
+  if (c) {
+    STR_PUSH(&p->io, " (");
+    str_push_u64(&p->io, c);
+    STR_PUSH(&p->io, " cycles)");
+  }
+  STR_PUSH(&p->io, "? [y]es [n]o");
+  fm_draw_nav_end(p);
+  fm_draw_flush(p);
+  p->f |= FM_REDRAW;
+  for (;;) {
+    if (!term_key_read(p->t.fd, &p->k))
+      return 'n';
+    switch (p->k.b[0]) {
+    case 'y': case 'n':
+      return p->k.b[0];
     }
   }
+}
+
+//
+// Rename the marks, or the entry under the cursor, by editing their names in
+// $EDITOR. Nothing is overwritten and swaps work. Emptying the file aborts.
+//
+static inline int
+fm_cmd_bulk_rename(struct fm *p, str *s)
+{
+  (void) s;
+  if (p->vml && !(p->f & FM_MARK_PWD)) {
+    fm_draw_err(p, S("not in mark directory"), 0);
+    return -1;
+  }
+  if (!p->vml && p->c == SIZE_MAX) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  const str *d = p->vml ? &p->mpwd : &p->pwd;
+  struct fs_prog g = {0};
+  char *m = NULL;
+  usize ml = 0;
+  usize c = 0;
+  usize n = fm_ren_load(p);
+  usize l = fm_ren_edit(p, n, &m, &ml);
+  int r = l == SIZE_MAX ? -1 : 0;
+  if (r < 0 || !l) goto e;
+  if (l != n) {
+    fm_draw_err(p, S("rename: line count changed"), 0);
+    r = -1;
+    goto e;
+  }
+  if ((r = fm_ren_link(p, n)) < 0) goto e;
+  usize k = fm_ren_plan(p, n, &c);
+  if (!k || fm_prompt_rename(p, k, c) != 'y') goto e;
+  int fd = open(d->m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (fd < 0)
+    fs_prog_err(&g, d->m, errno);
+  else {
+    journal_begin(&p->jr, JOURNAL_RENAME, d->m, d->m);
+    fm_ren_run(p, fd, k, &g);
+    fm_journal_end(p);
+    close(fd);
+  }
+  fm_cmd_mut(p);
+  fm_mark_clear_all(p);
+  if (g.ne) {
+    fm_draw_prog_err(p, CUT("rename"), &g, 0);
+    r = -1;
+  }
 e:
-  if (!(f & CMD_BG)) fm_term_raw(p);
+  if (m) munmap(m, ml);
   return r;
 }
 
-static inline int
-fm_cmd_build_each(struct fm *p, cut s, usize ti, usize tc, u32 f)
+//
+// Change one mark or the entry under the cursor. i is its place in the
+// listing, if it is there, in which case its mode is updated in place from
+// the result and the event the change causes is ignored.
+//
+static inline void
+fm_attr_ent(struct fm *p, struct fs_prog *g, int fd, const char *s, usize i)
 {
-  cut mk = CUT_NULL;
-  usize mp = p->mp - (tc + 1);
-  if (!p->vml) {
-    if (p->c == SIZE_MAX) return 0;
-    mk = fm_ent(p, p->c);
-    return fm_cmd_build(p, s, ti, tc, f, mp, mk, 1);
+  mode_t o = (mode_t) -1;
+  mode_t n = 0;
+  u64 m = 0;
+  u8 t = ENT_UNKNOWN;
+  if (i != SIZE_MAX) {
+    m = ent_load(p, i);
+    t = (u8) ent_get(m, TYPE);
   }
-  if (!(f & CMD_BG)) fm_term_cooked(p);
-  for (; p->ml; ) {
-    mk = fm_mark_at(p, 0);
-    str fp = p->mpwd;
-    str_push_c(&fp, '/');
-    str_push(&fp, mk.d, mk.l);
-    str_terminate(&fp);
-    mk = (cut) { fp.m, fp.l };
-    if (fm_cmd_build(p, s, ti, tc, f, mp, mk, 0) < 0) {
-      if (!(f & CMD_BG)) fm_term_raw(p);
-      return -1;
+  if (!ENT_IS_LNK(t) && t != ENT_UNKNOWN)
+    o = (mode_t) ent_get(m, PERM) | (ENT_IS_DIR(t) ? S_IFDIR : S_IFREG);
+  int r = fs_attr_at(&p->at, fd, s, o, 0, &n);
+  if (r < 0) {
+    fs_prog_err(g, s, errno);
+    return;
+  }
+  g->nf++;
+  if (r || o == (mode_t) -1) return;
+  if (!p->at.m && o & (S_ISUID|S_ISGID)) return;
+  if (p->at.m) {
+    if (t == ENT_REG || t == ENT_REG_EXEC) {
+      u8 y = n & 0111 ? ENT_REG_EXEC : ENT_REG;
+      fm_v_attr_clr(p, i, t);
+      fm_v_attr_set(p, i, y, ent_v_geto(p, i, DOT));
+      ent_set(&m, TYPE, y);
     }
-    fm_mark_pop_first(p);
-    if (p->vml) p->vml--;
+    ent_set(&m, PERM, n);
+    ent_store(p, i, m);
+    fm_row_drop(p, ent_v_geto(p, i, OFF));
   }
-  if (!(f & CMD_BG)) fm_term_raw(p);
-  return 0;
+  u32 x = ent_v_load(p, i);
+  ent_v_set(&x, ECHO, 1);
+  ent_v_store(p, i, x);
 }
 
+//
+// chmod or chown the marks, or the entry under the cursor, with one syscall
+// each. A leading -R has a background job do everything below them.
+//
 static inline int
-fm_cmd_sh(struct fm *p, cut c)
+fm_cmd_attr(struct fm *p, str *s, cut n, bool md)
 {
-  if (!c.l) return 0;
-  cut f = !p->ml && p->c != SIZE_MAX ? fm_ent(p, p->c) : CUT_NULL;
-  cut sh = get_env("SHELL", "/bin/sh");
-  const char *cmd[] = { sh.d, DFM_SHELL_OPTS, c.d, CFG_NAME, f.d, NULL };
-  STATIC_ASSERT(ARR_SIZE(cmd) < DFM_MARK_CMD_PRE, "");
-  usize l = ARR_SIZE(cmd) - (!f.l * 2);
-  char **m = (char **)(void *)p->d.d;
-  char **a = &m[p->mp - l];
-  memcpy(a, cmd, sizeof(*cmd) * l);
-  if (!f.l) a[l + p->ml] = NULL;
-  int r =
-    fm_exec(p, -1, f.l ? p->pwd.m : p->mpwd.m, (const char *const *)a, 0, 1);
-  if (!f.l) fm_mark_clear_all(p);
-  if (r < 0) p->f |= FM_ERROR;
-  return r;
+  struct fs_attr *a = &p->at;
+  struct fs_prog g = {0};
+  if (!p->vml && p->c == SIZE_MAX) {
+    fm_draw_err(p, S("nothing to operate on"), 0);
+    return -1;
+  }
+  str_terminate(s);
+  char *c = s->m;
+  bool rc = !strncmp(c, "-R ", 3);
+  for (c += rc ? 3 : 0; *c == ' '; c++);
+  a->m = md ? c : NULL;
+  a->u = umask(0);
+  umask(a->u);
+  mode_t x;
+  if (a->m ? fs_mode(c, 0, a->u, 0, &x) < 0 : fs_owner(c, &a->o, &a->r) < 0) {
+    fm_draw_err(p, n.d, n.l, EINVAL);
+    return -1;
+  }
+  const str *d = p->vml ? &p->mpwd : &p->pwd;
+  bool h = !p->vml || p->f & FM_MARK_PWD;
+  int fd = open(d->m, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (fd < 0)
+    fs_prog_err(&g, d->m, errno);
+  else if (!p->vml)
+    fm_attr_ent(p, &g, fd, fm_ent(p, p->c).d, p->c);
+  else if (p->ml) {
+    for (usize i = 0; i < p->ml; i++) {
+      cut m = fm_mark_at(p, i);
+      u16 e = 0xFFFF;
+      if (h) fm_dir_ht_find(p, m, &e);
+      fm_attr_ent(p, &g, fd, m.d, e == 0xFFFF ? SIZE_MAX : e);
+    }
+  } else {
+    for (usize b = 0; b < BITSET_W(p->dl); b++)
+      for (u64 w = p->vm[b] & p->v[b]; w; w &= w - 1) {
+        usize i = (b << 6) + u64_ctz(w);
+        if (i < p->dl) fm_attr_ent(p, &g, fd, fm_ent(p, i).d, i);
+      }
+  }
+  if (fd >= 0) close(fd);
+  p->f |= FM_DIRTY;
+  if (rc && fd >= 0 && fm_job_start(p, n, fm_job_attr) < 0)
+    return -1;
+  fm_mark_clear_all(p);
+  if (!g.ne) return 0;
+  fm_draw_prog_err(p, n, &g, 0);
+  return -1;
 }
 
 static inline int
-fm_cmd_run_sh(struct fm *p, str *s)
+fm_cmd_chmod(struct fm *p, str *s)
 {
-  if (fm_mark_materialize(p) < 0) {
-    fm_draw_err(p, S("not enough memory to materialize marks"), 0);
-    return -1;
-  }
-  usize e = s->m[0] == '!';
-  return fm_cmd_sh(p, (cut){ s->m + e, s->l - e });
+  return fm_cmd_attr(p, s, CUT("chmod"), 1);
 }
 
-static inline cut
-fm_cmd_parse(struct fm *p, str *s, usize *oti, usize *ott, usize *otc)
+static inline int
+fm_cmd_chown(struct fm *p, str *s)
 {
-  cut c;
-  usize tc = 0;
-  usize ti = SIZE_MAX;
-  usize tt = 0;
-  usize li = 0;
-  cut lt = CUT_NULL;
-  for (usize i = 0, n = 0; next_tok(s->m, s->l, &n, &c); i++, tc++) {
-    ((char *)c.d)[c.l] = 0;
-    lt = c;
-    li = i;
-    if (ti == SIZE_MAX && c.l == 2 && c.d[0] == '%') {
-      if (c.d[1] == 'm' || c.d[1] == 'f' ) {
-        ti = i;
-        tt = c.d[1];
-      }
-    }
-  }
-  if (tc && lt.l == 1 && lt.d[0] == '&') {
-    p->cf |= CMD_BG;
-    tc--;
-    if (ti != SIZE_MAX && li < ti) ti--;
-  }
-  *oti = ti;
-  *ott = tt;
-  *otc = tc;
-  c = (cut){ s->m, s->l };
-  switch (s->m[0]) {
-    case '<': c.d++; c.l--; p->cf |= CMD_STDIN; break;
-  }
-  return c;
+  return fm_cmd_attr(p, s, CUT("chown"), 0);
 }
 
+//
+// Cancel the job with the given number, or the only one running when none
+// is given.
+//
 static inline int
-fm_cmd_run(struct fm *p, str *s)
+fm_cmd_job_cancel(struct fm *p, str *s)
 {
-  int m = CMD_MODE_SINGLE;
-  int r = 0;
-  if (!s->l) return 0;
-  if (p->cf & CMD_MARK_DIR && !(p->f & FM_MARK_PWD) && p->vml) {
-    fm_draw_err(p, S("not in mark directory"), 0);
+  usize i = 0;
+  if (s->l) {
+    for (usize j = 0; j < s->l && s->m[j] >= '0' && s->m[j] <= '9'; j++)
+      i = i * 10 + (usize)(s->m[j] - '0');
+    i--;
+  } else if (!p->jn) {
+    fm_draw_err(p, S("no jobs"), 0);
     return -1;
-  }
-  if (p->cf & CMD_NOT_MARK_DIR && p->f & FM_MARK_PWD) {
-    fm_draw_err(p, S("in mark directory"), 0);
+  } else if (p->jn > 1) {
+    fm_draw_err(p, S("more than one job, give its number"), 0);
     return -1;
-  }
-  if (s->m[0] == '!')
-    return fm_cmd_run_sh(p, s);
-  usize ti;
-  usize tt;
-  usize tc;
-  cut a = fm_cmd_parse(p, s, &ti, &tt, &tc);
-  if ((tt && (!p->vml && !p->vl))) {
-    fm_draw_err(p, S("nothing to operate on"), 0);
+  } else
+    while (!p->jb[i].pid) i++;
+  if (i >= DFM_JOB_MAX || fm_job_cancel(p, i) < 0) {
+    fm_draw_err(p, S("no such job"), 0);
     return -1;
   }
-  if (p->cf & (CMD_STDIN|CMD_FILE_CURSOR))
-    m = CMD_MODE_SINGLE;
-  else if (tt == 'm') {
-    m = p->f & FM_MARK_PWD ? CMD_MODE_CHUNK : CMD_MODE_BULK;
-    m = p->vml ? m : CMD_MODE_EACH;
-  } else if (tt == 'f')
-    m = p->f & FM_MARK_PWD ? CMD_MODE_VIRTUAL : CMD_MODE_EACH;
-  switch (m) {
-  case CMD_MODE_SINGLE:
-  case CMD_MODE_EACH:
-  case CMD_MODE_VIRTUAL:
-    if (tc > DFM_MARK_CMD_PRE) {
-      fm_draw_err(p, S("argv too large"), 0);
-      return -1;
-    }
-    break;
-  case CMD_MODE_BULK:
-  case CMD_MODE_CHUNK:
-    if (ti > DFM_MARK_CMD_PRE || tc - ti - 1 > DFM_MARK_CMD_POST) {
-      fm_draw_err(p, S("argv too large"), 0);
-      return -1;
-    }
-  }
-  switch (m) {
-  case CMD_MODE_EACH:
-  case CMD_MODE_BULK:
-    if (p->cf & CMD_CONFLICT) {
-      r = fm_prepare_marks_conflict(p);
-      if (r < 0) p->f |= FM_REDRAW_NAV;
-      if (r == -1) return 0;
-      if (r == -2 && !p->ml) return 0;
-    }
-    break;
-  }
-  cut mk = CUT_NULL;
-  switch (m) {
-  case CMD_MODE_SINGLE:
-    if (p->c != SIZE_MAX)
-      mk = fm_ent(p, p->c);
-    r = fm_cmd_build(p, a, ti, tc, p->cf, p->mp - (tc + 1), mk, 1);
-    break;
-  case CMD_MODE_EACH:
-    r = fm_cmd_build_each(p, a, ti, tc, p->cf);
-    break;
-  case CMD_MODE_VIRTUAL:
-    r = fm_cmd_build_each_virtual(p, a, ti, tc, p->cf);
-    break;
-  case CMD_MODE_BULK:
-    r = fm_cmd_build_bulk(p, a, ti, tc, p->cf);
-    break;
-  case CMD_MODE_CHUNK:
-    r = fm_cmd_build_bulk_chunk(p, a, ti, tc, p->cf);
-    break;
-  }
-#ifdef FS_WATCH
-  if (r != -1 && p->cf & CMD_MUT)
-    p->f |= FM_DIRTY_WITHIN;
-#else
-  if (r != -1 && (p->cf & (CMD_MUT)))
-    fm_dir_refresh(p);
-#endif
-  if (r == -2)
-    fm_draw_err(p, S("environment variable unset"), 0);
-  if (r < 0) p->f |= FM_ERROR;
-  return r;
+  return 0;
 }
 
 // }}}
@@ -2862,6 +5979,32 @@ act_quit_print_pwd(struct fm *p)
   act_quit(p);
 }
 
+static inline void
+act_job_list(struct fm *p)
+{
+  if (!p->jn) {
+    fm_draw_msg(p, S("no jobs"));
+    return;
+  }
+  fm_draw_msg(p, S("jobs:"));
+  for (usize i = 0; i < DFM_JOB_MAX; i++) {
+    const struct fs_prog *g = &p->jg[i];
+    if (!p->jb[i].pid) continue;
+    STR_PUSH(&p->r.cl, " [");
+    str_push_u32(&p->r.cl, (u32)i + 1);
+    STR_PUSH(&p->r.cl, "] ");
+    str_push(&p->r.cl, p->jb[i].n.d, p->jb[i].n.l);
+    str_push_c(&p->r.cl, ' ');
+    ent_size_decode(&p->r.cl, ent_size_encode((off_t)g->nb), 0, ENT_TYPE_MAX);
+    str_push_c(&p->r.cl, '/');
+    ent_size_decode(&p->r.cl, ent_size_encode((off_t)g->tb), 0, ENT_TYPE_MAX);
+    str_push_c(&p->r.cl, ' ');
+    str_push_u64(&p->r.cl, g->nf);
+    str_push_c(&p->r.cl, '/');
+    str_push_u64(&p->r.cl, g->tf);
+  }
+}
+
 static inline void
 act_toggle_root(struct fm *p)
 {
@@ -2930,8 +6073,44 @@ static inline void
 act_cd_trash(struct fm *p)
 {
   cut e = get_env("DFM_TRASH_DIR", DFM_TRASH_DIR);
-  if (e.l) fm_path_cd(p, e.d, e.l);
-  else fm_draw_err(p, S("DFM_TRASH_DIR not set"), 0);
+  if (e.l) {
+    fm_path_cd(p, e.d, e.l);
+    return;
+  }
+  char h[PATH_MAX];
+  int n = trash_home(h, sizeof(h) - 6);
+  if (n < 0) {
+    fm_draw_err(p, S("trash"), errno);
+    return;
+  }
+  memcpy(h + n, "/files", 7);
+  fm_path_cd(p, h, (usize) n + 6);
+}
+
+//
+// Put back the last batch of moves, bulk renames or trashes in the journal.
+//
+static inline void
+act_undo(struct fm *p)
+{
+  struct fs_prog g = {0};
+  long n = journal_undo(&g);
+  if (n < 0) {
+    fm_draw_err(p, S("undo: journal"), errno);
+    return;
+  }
+  if (n) fm_cmd_mut(p);
+  if (g.ne) {
+    fm_draw_prog_err(p, CUT("undo"), &g, 0);
+    return;
+  }
+  if (!n) {
+    fm_draw_msg(p, S("nothing to undo"));
+    return;
+  }
+  fm_draw_msg(p, S("undo: "));
+  str_push_u64(&p->r.cl, (u64) n);
+  STR_PUSH(&p->r.cl, " renamed back");
 }
 
 static inline void
@@ -2969,6 +6148,11 @@ ACT_CD_BOOKMARK(8) ACT_CD_BOOKMARK(9)
 static inline void
 act_cd_up(struct fm *p)
 {
+  if (p->f & FM_FIND && !(p->f & FM_SEARCH)) {
+    fm_find_leave(p);
+    return;
+  }
+
   if (p->f & FM_SEARCH) {
     rl_clear(&p->r);
     fm_filter_clear(p);
@@ -3126,8 +6310,10 @@ act_view_next(struct fm *p)
     case 's': p->dv = 'p'; break;
     case 'p': p->dv = 't'; break;
     case 't': p->dv = 'a'; break;
-    case 'a': p->dv = 'n'; break;
+    case 'a': p->dv = 'g'; break;
+    case 'g': p->dv = 'n'; break;
   }
+  fm_cursor_set(p, p->y, p->o);
   p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
@@ -3155,7 +6341,53 @@ act_redraw(struct fm *p)
 static inline void
 act_refresh(struct fm *p)
 {
-  fm_dir_refresh(p);
+  fm_pane_clear(p);
+  if (p->dc) {
+    fm_du_stop(p);
+    memset(p->dc, 0, sizeof(*p->dc) * DFM_DU_CACHE);
+  }
+  if (p->f & FM_FIND) fm_find_leave(p);
+  else fm_dir_refresh(p);
+}
+
+//
+// Cycle du mode. Entries show the allocated size of everything under them,
+// then the apparent size, then their own size again.
+//
+static inline void
+act_du(struct fm *p)
+{
+  switch (p->dz) {
+    default:  p->dz = 'a'; break;
+    case 'a': p->dz = 'b'; break;
+    case 'b': p->dz = 0;   break;
+  }
+  if (!p->dz) fm_du_stop(p);
+  else if (p->dv != 's' && p->dv != 'a') p->dv = 's';
+  if (!(p->f & FM_FIND)) fm_dir_refresh(p);
+  p->f |= FM_REDRAW_DIR;
+  switch (p->dz) {
+    case 'a': fm_draw_msg(p, S("du: allocated size")); break;
+    case 'b': fm_draw_msg(p, S("du: apparent size"));  break;
+    default:  fm_draw_msg(p, S("du: off"));            break;
+  }
+}
+
+static inline void
+act_toggle_panes(struct fm *p)
+{
+  p->f ^= FM_PANES;
+  if (!(p->f & FM_PANES)) fm_pane_cancel(p);
+  fm_pane_layout(p);
+  fm_cursor_set(p, p->y, p->o);
+  p->f |= FM_REDRAW;
+}
+
+static inline void
+act_stop(struct fm *p)
+{
+  if (p->f & FM_WALK) fm_find_stop(p);
+  if (p->f & FM_GREP) fm_grep_stop(p);
 }
 
 static inline void
@@ -3176,7 +6408,7 @@ static inline void
 act_page_down(struct fm *p)
 {
   if (!p->vl) return;
-  usize ny = p->y + p->row;
+  usize ny = p->y + p->row * fm_grid(p);
   if (ny >= p->vl) ny = p->vl - 1;
   fm_cursor_set(p, ny, p->row - 1);
   p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
@@ -3186,47 +6418,82 @@ static inline void
 act_page_up(struct fm *p)
 {
   if (!p->vl) return;
-  usize ny = (p->y > p->row) ? (p->y - p->row) : 0;
+  usize k = p->row * fm_grid(p);
+  usize ny = (p->y > k) ? (p->y - k) : 0;
   fm_cursor_set(p, ny, 0);
   p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
 static inline void
-act_scroll_down(struct fm *p)
+act_scroll_next(struct fm *p)
 {
   if (unlikely(p->y + 1 >= p->vl)) return;
-  usize l = p->c;
-  p->y++;
-  p->o += p->o < p->row - 1;
   usize n = ent_next(p, p->c + 1);
   if (n == SIZE_MAX) return;
+  p->y++;
+  p->o += p->o < p->row - 1;
   p->c = n;
-  fm_draw_ent(p, l);
-  STR_PUSH(&p->io, VT_LF);
-  fm_draw_ent(p, p->c);
-  p->f |= FM_REDRAW_NAV;
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
 static inline void
-act_scroll_up(struct fm *p)
+act_scroll_prev(struct fm *p)
 {
   if (unlikely(!p->y)) return;
-  usize l = p->c;
-  p->y--;
   usize n = ent_prev(p, p->c - 1);
   if (n == SIZE_MAX) return;
+  p->y--;
+  p->o -= !!p->o;
   p->c = n;
-  fm_draw_ent(p, l);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
 
-  if (!p->o) {
-    STR_PUSH(&p->io, VT_IL0);
-  } else {
-    p->o -= !!p->o;
-    STR_PUSH(&p->io, VT_CUU1);
+//
+// In the grid view the cursor moves a line at a time vertically and an
+// entry at a time horizontally. Elsewhere both are the same.
+//
+static inline void
+act_scroll_down(struct fm *p)
+{
+  usize g = fm_grid(p);
+  if (g == 1) {
+    act_scroll_next(p);
+    return;
+  }
+  if (!p->vl || p->y / g == (p->vl - 1) / g) return;
+  fm_cursor_set(p, MIN(p->y + g, p->vl - 1), p->o + 1);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
+
+static inline void
+act_scroll_up(struct fm *p)
+{
+  usize g = fm_grid(p);
+  if (g == 1) {
+    act_scroll_prev(p);
+    return;
   }
+  if (p->y < g) return;
+  fm_cursor_set(p, p->y - g, p->o - !!p->o);
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
 
-  fm_draw_ent(p, p->c);
-  p->f |= FM_REDRAW_NAV;
+static inline void
+act_scroll_right(struct fm *p)
+{
+  usize g = fm_grid(p);
+  if (g == 1 || p->y + 1 >= p->vl) return;
+  fm_cursor_set(p, p->y + 1, p->o + !((p->y + 1) % g));
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+}
+
+static inline void
+act_scroll_left(struct fm *p)
+{
+  usize g = fm_grid(p);
+  if (g == 1 || !p->y) return;
+  fm_cursor_set(p, p->y - 1, p->o - (!(p->y % g) && p->o));
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
 static inline void
@@ -3241,6 +6508,28 @@ act_toggle_hidden(struct fm *p)
   fm_cursor_sync(p);
 }
 
+static inline void
+act_filter_type(struct fm *p, u16 m)
+{
+  cut c = p->c == SIZE_MAX ? CUT_NULL : fm_ent(p, p->c);
+  p->vf = p->vf == m ? ENT_MASK_ALL : m;
+  fm_filter_clear(p);
+  fm_scroll_to(p, c);
+  fm_cursor_sync(p);
+}
+
+static inline void
+act_filter_dir(struct fm *p)
+{
+  act_filter_type(p, ENT_MASK_DIR);
+}
+
+static inline void
+act_filter_exec(struct fm *p)
+{
+  act_filter_type(p, ENT_MASK_EXEC);
+}
+
 static inline void
 act_search_startswith(struct fm *p)
 {
@@ -3300,8 +6589,7 @@ act_mark_toggle(struct fm *p)
     return;
   }
   fm_mark_invalidate(p);
-  fm_draw_ent(p, p->c);
-  p->f |= FM_REDRAW_NAV;
+  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
 }
 
 static inline void
@@ -3338,9 +6626,7 @@ act_mark_next(struct fm *p)
   if (!p->vml || p->c == SIZE_MAX) return;
   usize b = fm_mark_find(p, p->c, 1);
   if (b == SIZE_MAX) return;
-  usize r = fm_filter_pct_rank(p, b);
-  size y = fm_scroll_to_rank(p, r);
-  while (y-- > 0) act_scroll_down(p);
+  fm_scroll_to_rank(p, fm_filter_pct_rank(p, b));
 }
 
 static inline void
@@ -3349,9 +6635,7 @@ act_mark_prev(struct fm *p)
   if (!p->vml || p->c == SIZE_MAX) return;
   usize b = fm_mark_find(p, p->c, -1);
   if (b == SIZE_MAX) return;
-  usize r = fm_filter_pct_rank(p, b);
-  size y = fm_scroll_to_rank(p, r);
-  while (y++ < 0) act_scroll_up(p);
+  fm_scroll_to_rank(p, fm_filter_pct_rank(p, b));
 }
 
 static inline void
@@ -3409,7 +6693,7 @@ act_mark_range(struct fm *p)
   usize lo = MIN(ml, p->c);
   usize hi = MAX(ml, p->c);
   for (usize i = lo; i <= hi; i++) {
-    if (!ent_v_geto(p, i, VIS)) continue;
+    if (!fm_v_get(p, i)) continue;
     if (!ent_v_geto(p, i, MARK))
       fm_mark_toggle_idx(p, i);
   }
@@ -3635,12 +6919,38 @@ input_insert_paste(struct fm *p)
 
 // Init {{{
 
+//
+// Output is collected in segments. When one fills up the next is used and
+// the whole frame is written at once when it ends (n is 0) or every segment
+// is in use.
+//
+static inline void
+fm_io_write(struct fm *p, int e)
+{
+  usize l = 0;
+  for (usize i = 0; i < p->il; i++) l += p->iv[i].iov_len;
+  if (l) writev_all(p->t.fd, p->iv, (int) p->il);
+#ifdef DFM_STATS
+  p->sx.b += l;
+  p->sx.w += !!l;
+  p->sx.fc += l;
+  if (e) {
+    p->sx.fm = MAX(p->sx.fm, p->sx.fc);
+    p->sx.fc = 0;
+  }
+#else
+  (void) e;
+#endif
+  p->il = 0;
+}
+
 static inline usize
 fm_io_flush(str *s, void *ctx, usize n)
 {
-  (void) n;
   struct fm *p = ctx;
-  write_all(p->t.fd, s->m, s->l);
+  p->iv[p->il++] = (struct iovec){ s->m, s->l };
+  if (!n || p->il == DFM_IO_IOV) fm_io_write(p, !n);
+  s->m = p->ib[p->il];
   s->l = 0;
   return 0;
 }
@@ -3664,29 +6974,68 @@ fm_init(struct fm *p)
   p->opener = get_env("DFM_OPENER", DFM_OPENER);
   p->im = get_env("DFM_IMG_MODE", DFM_IMG_MODE).d[0];
   p->dfd = AT_FDCWD;
+  p->gd = -1;
+  p->pd = -1;
   p->ds = DFM_DEFAULT_SORT;
   p->dv = DFM_DEFAULT_VIEW;
   p->sf = fm_filter_startswith;
+  p->vf = ENT_MASK_ALL;
   p->dec = sizeof(p->de);
   p->tz  = tz_offset();
 #if DFM_SHOW_HIDDEN
   p->f |= FM_HIDDEN;
+#endif
+#if DFM_SHOW_PANES
+  p->f |= FM_PANES;
 #endif
   if (!geteuid()) p->f |= FM_ROOT;
+  p->jg = mmap(NULL, sizeof(*p->jg) * DFM_JOB_MAX, PROT_READ|PROT_WRITE,
+    MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if (p->jg == MAP_FAILED)
+    return -1;
   fm_mark_clear_all(p);
   STR_INIT(&p->pwd,  DFM_PATH_MAX, 0, 0);
   STR_INIT(&p->ppwd, DFM_PATH_MAX, 0, 0);
   STR_INIT(&p->mpwd, DFM_PATH_MAX, 0, 0);
-  STR_INIT(&p->io,   DFM_IO_MAX,   fm_io_flush, p);
+  str_init(&p->io, p->ib[0], DFM_IO_MAX, fm_io_flush, p);
+  STR_INIT(&p->ro,   DFM_IO_MAX,   0, 0);
+#ifdef DFM_STATS
+  p->sx.t = fm_clock();
+#endif
   return 0;
 }
 
 static inline void
 fm_free(struct fm *p)
 {
+  fm_find_stop(p);
+  fm_pane_cancel(p);
   fs_watch_free(&p->p);
   close(p->dfd);
   int fd = term_dead(&p->t) ? STDOUT_FILENO : STDERR_FILENO;
+#ifdef DFM_STATS
+  str *s = &p->ro;
+  u64 t = fm_clock() - p->sx.t;
+  s->l = 0;
+  STR_PUSH(s, "bytes written: ");
+  str_push_u64(s, p->sx.b);
+  STR_PUSH(s, "\nwrites: ");
+  str_push_u64(s, p->sx.w);
+  STR_PUSH(s, "\nlargest frame: ");
+  str_push_u64(s, p->sx.fm);
+  STR_PUSH(s, "\nkeys: ");
+  str_push_u64(s, p->sx.k);
+  STR_PUSH(s, "\nframes: ");
+  str_push_u64(s, p->sx.f);
+  STR_PUSH(s, "\nframes per second: ");
+  str_push_u64(s, t ? p->sx.f * 1000000 / t : 0);
+  STR_PUSH(s, "\nkey to frame latency (us): avg ");
+  str_push_u64(s, p->sx.ln ? p->sx.l / p->sx.ln : 0);
+  STR_PUSH(s, " max ");
+  str_push_u64(s, p->sx.lm);
+  str_push_c(s, '\n');
+  write_all(STDERR_FILENO, s->m, s->l);
+#endif
   if (!p->pwd.l) return;
   write_all(fd, p->pwd.m, p->pwd.l);
   write_all(fd, S("\n"));
@@ -3702,27 +7051,61 @@ fm_watch_handle(struct fm *p)
   for (cut n = {0};;) {
     char r = fs_watch_pump(&p->p, &n.d, &n.l);
     if (!r) return;
+    if (p->f & FM_FIND) {
+      if (r == '-') fm_find_del(p, n);
+      continue;
+    }
     if (r == '!' || !n.l) {
+      fm_pane_clear(p);
       fm_dir_refresh(p);
       return;
     }
+    fm_pane_drop(p, n);
     switch (r) {
     case '+': fm_dir_add(p, n); break;
     case '-': fm_dir_del(p, n); break;
-    case '~': fm_dir_del(p, n); fm_dir_add(p, n); break;
+    case '~':
+      if (!fm_dir_echo(p, n)) fm_dir_change(p, n);
+      break;
     }
   }
 }
 
+//
+// Milliseconds until changes to the listing may be applied again. Sorting
+// and redrawing for filesystem events and find results happen at most once
+// every DFM_FRAME_MS so bursts of events are batched.
+//
+static inline int
+fm_update_wait(struct fm *p)
+{
+  u64 n = fm_clock();
+  u64 e = p->fu + DFM_FRAME_MS * 1000;
+  return n >= e ? 0 : (int)((e - n + 999) / 1000);
+}
+
 static inline void
 fm_update(struct fm *p)
 {
-  term_reap();
+  if (p->f & FM_DU) fm_du_start(p);
+  if (p->dr) fm_du_step(p);
+  fm_job_reap(p);
+  if (p->jn) fm_job_step(p);
   fm_watch_handle(p);
-  if (!(p->f & FM_DIRTY)) return;
+  if (p->f & FM_WALK) fm_find_step(p);
+  if (p->f & FM_GREP) fm_grep_step(p);
+  if (p->f & FM_PANES) fm_pane_step(p);
+  if (!(p->f & FM_DIRTY) || fm_update_wait(p)) return;
+  p->fu = fm_clock();
+  if (p->f & FM_GREP) {
+    fm_grep_stop(p);
+    fm_draw_msg(p, S("grep: directory changed, search stopped"));
+  }
   p->f &= ~FM_DIRTY;
-  p->f |= FM_REDRAW_DIR|FM_REDRAW_NAV;
+  p->f |= FM_REDRAW_DIR;
+  if (!(p->f & FM_NAV_MSG)) p->f |= FM_REDRAW_NAV;
   fm_dir_sort(p);
+  if (p->f & FM_FIND) fm_dir_mark_rebuild(p);
   fm_cursor_sync(p);
   if (p->f & FM_DIRTY_WITHIN && p->st) {
     u64 m = ent_load_off(p, p->st);
@@ -3739,19 +7122,34 @@ fm_draw(struct fm *p)
   if ((p->f & FM_REDRAW) == FM_REDRAW) {
     STR_PUSH(&p->io, VT_ED2);
     fm_clear_cache(p);
+    fm_draw_shadow_clear(p);
   }
   if (p->f & FM_REDRAW_DIR)
     fm_draw_dir(p);
+  if (p->f & FM_REDRAW_DIR && fm_panes(p))
+    fm_draw_panes(p);
   if (p->f & FM_REDRAW_NAV)
     fm_draw_nav(p);
   if (p->f & FM_REDRAW_CMD)
     fm_draw_cmd(p);
+#ifdef DFM_STATS
+  if (p->f & FM_REDRAW) p->sx.f++;
+  if (p->f & FM_REDRAW && p->sx.kt) {
+    u64 l = fm_clock() - p->sx.kt;
+    p->sx.l += l;
+    p->sx.lm = MAX(p->sx.lm, l);
+    p->sx.ln++;
+    p->sx.kt = 0;
+  }
+#endif
   if (p->f & FM_REDRAW) {
     if (p->kp || p->kd) {
       vt_cup(&p->io, p->r.vx, p->row + DFM_MARGIN);
       STR_PUSH(&p->io, VT_DECTCEM_Y);
     } else {
-      vt_cup(&p->io, 0, p->o + 1);
+      usize g = fm_grid(p);
+      usize x = (p->y % g) * (g > 1 ? fm_grid_w(p) : 0);
+      vt_cup(&p->io, p->px + x + 1, p->o + 1);
       STR_PUSH(&p->io, VT_DECTCEM_N);
     }
     fm_draw_flush(p);
@@ -3764,6 +7162,10 @@ fm_input(struct fm *p)
 {
   if (!term_key_read(p->t.fd, &p->k))
     return;
+#ifdef DFM_STATS
+  p->sx.k++;
+  if (!p->sx.kt) p->sx.kt = fm_clock();
+#endif
   if (p->r.pr.l) fm_key_input(p->k.c)(p);
   else fm_key(p->k.c)(p);
 }
@@ -3796,13 +7198,28 @@ fm_run(struct fm *p)
   for (; likely(!term_dead(&p->t)); ) {
     fm_update(p);
     fm_draw(p);
-    int e = term_wait(&p->t);
+    int w = p->f & FM_GREP || fm_find_next(p) ? 0 : -1;
+    if ((p->f & FM_WALK || p->pd >= 0) && (w < 0 || w > DFM_FRAME_MS))
+      w = DFM_FRAME_MS;
+    if (p->f & FM_DIRTY && w) w = fm_update_wait(p);
+    if (p->jn && (w < 0 || w > DFM_JOB_MS)) w = DFM_JOB_MS;
+    int e = term_wait(&p->t, fs_watch_fd(&p->p), w);
     if (e & TERM_WAIT_WCH)
       if (fm_term_resize(p) < 0)
         fm_draw_err(p, S("resize failed"), errno);
-    if (e & TERM_WAIT_KEY)
+    if (!(e & TERM_WAIT_KEY))
+      continue;
+    //
+    // Handle every key already waiting before drawing so held keys and
+    // pastes produce one frame per batch instead of one per key.
+    //
+    fm_input(p);
+    for (usize i = 1; i < DFM_INPUT_MAX && likely(!term_dead(&p->t)); i++) {
+      if (!(term_wait(&p->t, -1, 0) & TERM_WAIT_KEY)) break;
       fm_input(p);
+    }
   }
+  fm_du_stop(p);
   fm_term_free(p);
   if (!(p->f & (FM_PRINT_PWD|FM_PICKER))) p->pwd.l = 0;
   return 0;
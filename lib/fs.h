@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2026 Dylan Araps
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef DYLAN_FS_H
+#define DYLAN_FS_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <grp.h>
+#include <limits.h>
+#include <pwd.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#if defined(__linux__)
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
+#endif
+
+#include "util.h"
+#include "walk.h"
+
+//
+// Recursive copy.
+//
+// The source tree is walked with walk.h and a matching stack of destination
+// directories is kept open beside it so every entry is created relative to its
+// parent and no full paths are ever built. Directories are created private and
+// get their real mode and times once their contents are done. Existing files
+// are overwritten and existing directories merged, like cp -Rf.
+//
+#ifndef FS_COPY_BUF
+#define FS_COPY_BUF (1 << 17)
+#endif
+
+#define FS_COPY_CHUNK (1 << 30)
+
+#if defined(__APPLE__)
+#define FS_ATIM st_atimespec
+#define FS_MTIM st_mtimespec
+#else
+#define FS_ATIM st_atim
+#define FS_MTIM st_mtim
+#endif
+
+//
+// Progress of an operation in bytes and entries, done and total, and the
+// number of entries that failed along with the first failure. It may live in
+// memory shared with another process that reads it. Failures and removed
+// entries are counted atomically so several processes can remove into one.
+//
+#ifndef FS_PROG_PATH
+#define FS_PROG_PATH 256
+#endif
+
+struct fs_prog {
+  volatile u64 nb;
+  volatile u64 nf;
+  volatile u64 tb;
+  volatile u64 tf;
+  volatile u64 ne;
+  volatile int e;
+  char ep[FS_PROG_PATH];
+};
+
+static inline void
+fs_prog_err(struct fs_prog *g, const char *s, int e)
+{
+  if (__atomic_fetch_add(&g->ne, 1, __ATOMIC_RELAXED)) return;
+  usize l = MIN(strlen(s), sizeof(g->ep) - 1);
+  memcpy(g->ep, s, l);
+  g->ep[l] = 0;
+  g->e = e;
+}
+
+struct fs_copy {
+  struct walk w;
+  int d[WALK_DEPTH];
+  mode_t m[WALK_DEPTH];
+  struct timespec t[WALK_DEPTH][2];
+  dev_t dev;
+  ino_t ino;
+  struct fs_prog *g;
+  char b[FS_COPY_BUF];
+};
+
+static inline void
+fs_copy_err(struct fs_copy *c, int e)
+{
+  fs_prog_err(c->g, c->w.p, e);
+}
+
+static inline void
+fs_copy_attr(int fd, const struct stat *s)
+{
+  struct timespec t[2] = { s->FS_ATIM, s->FS_MTIM };
+  fchmod(fd, s->st_mode & 07777);
+  futimens(fd, t);
+}
+
+//
+// Copy from the current offset of 'in' to the current offset of 'out'. The
+// cheapest method the kernel offers goes first and each fallback carries on
+// from wherever the one before it stopped. Files that claim to be empty skip
+// straight to read() as pseudo files often report no size.
+//
+static inline int
+fs_copy_data(struct fs_copy *c, int in, int out, u64 n)
+{
+#if defined(FICLONE)
+  if (n && !ioctl(out, FICLONE, in)) {
+    c->g->nb += n;
+    return 0;
+  }
+#endif
+#if defined(__linux__)
+  for (ssize_t r; n; ) {
+    r = copy_file_range(in, NULL, out, NULL, FS_COPY_CHUNK, 0);
+    if (!r) return 0;
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0) break;
+    c->g->nb += (u64) r;
+  }
+  for (ssize_t r; n; ) {
+    r = sendfile(out, in, NULL, FS_COPY_CHUNK);
+    if (!r) return 0;
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0) break;
+    c->g->nb += (u64) r;
+  }
+#else
+  (void) n;
+#endif
+  for (;;) {
+    ssize_t r = read(in, c->b, sizeof(c->b));
+    if (!r) return 0;
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0) return -1;
+    if (write_all(out, c->b, (usize) r) < 0) return -1;
+    c->g->nb += (u64) r;
+  }
+}
+
+static inline int
+fs_copy_file(struct fs_copy *c, int sfd, const char *s, int dfd,
+             const char *d, const struct stat *st)
+{
+  int in = openat(sfd, s, O_RDONLY|O_NOFOLLOW|O_CLOEXEC);
+  if (in < 0) return -1;
+  int f = O_WRONLY|O_CREAT|O_NOFOLLOW|O_CLOEXEC;
+  int out = openat(dfd, d, f, 0600);
+  if (out < 0 && errno != ENOENT && !unlinkat(dfd, d, 0))
+    out = openat(dfd, d, f, 0600);
+  int r = -1;
+  struct stat os;
+  if (out < 0 || fstat(out, &os) < 0)
+    goto e;
+  if (os.st_dev == st->st_dev && os.st_ino == st->st_ino) {
+    errno = EINVAL;
+    goto e;
+  }
+  if (ftruncate(out, 0) < 0 || fs_copy_data(c, in, out, (u64) st->st_size) < 0)
+    goto e;
+  fs_copy_attr(out, st);
+  r = 0;
+e:;
+  int e = errno;
+  if (out >= 0) close(out);
+  close(in);
+  errno = e;
+  return r;
+}
+
+static inline int
+fs_copy_link(struct fs_copy *c, int sfd, const char *s, int dfd,
+             const char *d, const struct stat *st)
+{
+  ssize_t l = readlinkat(sfd, s, c->b, sizeof(c->b) - 1);
+  if (l < 0) return -1;
+  c->b[l] = 0;
+  if (symlinkat(c->b, dfd, d) < 0 && (errno != EEXIST ||
+      unlinkat(dfd, d, 0) < 0 || symlinkat(c->b, dfd, d) < 0))
+    return -1;
+  struct timespec t[2] = { st->FS_ATIM, st->FS_MTIM };
+  utimensat(dfd, d, t, AT_SYMLINK_NOFOLLOW);
+  return 0;
+}
+
+static inline int
+fs_copy_node(int dfd, const char *d, const struct stat *st)
+{
+  mode_t m = st->st_mode & 07777;
+  int r = S_ISFIFO(st->st_mode) ? mkfifoat(dfd, d, m) :
+    mknodat(dfd, d, st->st_mode & (S_IFMT|07777), st->st_rdev);
+  if (r < 0 && errno == EEXIST && !unlinkat(dfd, d, 0))
+    r = S_ISFIFO(st->st_mode) ? mkfifoat(dfd, d, m) :
+      mknodat(dfd, d, st->st_mode & (S_IFMT|07777), st->st_rdev);
+  return r;
+}
+
+static inline int
+fs_copy_ent(struct fs_copy *c, int sfd, const char *s, int dfd,
+            const char *d, const struct stat *st)
+{
+  int r;
+  if (S_ISREG(st->st_mode))
+    r = fs_copy_file(c, sfd, s, dfd, d, st);
+  else if (S_ISLNK(st->st_mode))
+    r = fs_copy_link(c, sfd, s, dfd, d, st);
+  else
+    r = fs_copy_node(dfd, d, st);
+  c->g->nf += !r;
+  return r;
+}
+
+static inline int
+fs_copy_dir_open(struct fs_copy *c, int dfd, const char *d, usize i,
+                 const struct stat *st)
+{
+  if (mkdirat(dfd, d, 0700) < 0 && errno != EEXIST)
+    return -1;
+  int fd = openat(dfd, d, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+  if (fd < 0) return -1;
+  c->d[i] = fd;
+  c->m[i] = st->st_mode & 07777;
+  c->t[i][0] = st->FS_ATIM;
+  c->t[i][1] = st->FS_MTIM;
+  return 0;
+}
+
+static inline void
+fs_copy_dir_close(struct fs_copy *c, usize i)
+{
+  fchmod(c->d[i], c->m[i]);
+  futimens(c->d[i], c->t[i]);
+  close(c->d[i]);
+  c->g->nf++;
+}
+
+static inline void
+fs_count_ent(struct fs_prog *g, const struct stat *st)
+{
+  g->tf++;
+  if (S_ISREG(st->st_mode)) g->tb += (u64) st->st_size;
+}
+
+//
+// Add the entries and bytes below 's' in the directory 'sfd' to the totals
+// so progress can be given as a fraction.
+//
+static inline int
+fs_count(struct walk *w, struct fs_prog *g, int sfd, const char *s)
+{
+  struct stat st;
+  if (fstatat(sfd, s, &st, AT_SYMLINK_NOFOLLOW) < 0)
+    return -1;
+  fs_count_ent(g, &st);
+  if (!S_ISDIR(st.st_mode))
+    return 0;
+  if (walk_open(w, sfd, s) < 0)
+    return -1;
+  for (int r; (r = walk_next(w)); ) {
+    if (r != WALK_ENT) continue;
+    if (fstatat(walk_dfd(w), w->p + w->b, &st, AT_SYMLINK_NOFOLLOW) < 0)
+      continue;
+    fs_count_ent(g, &st);
+    if (S_ISDIR(st.st_mode)) walk_push(w);
+  }
+  return 0;
+}
+
+//
+// Copy 's' in the directory 'sfd' to 'd' in the directory 'dfd'.
+// A failed entry does not stop the rest of the tree from being copied, each
+// failure is counted in c->g and -1 returned at the end. A source directory
+// that turns out to be the copy being made is skipped so copying a directory
+// into itself terminates.
+//
+static inline int
+fs_copy(struct fs_copy *c, int sfd, const char *s, int dfd, const char *d)
+{
+  struct stat st;
+  struct stat ds;
+  u64 ne = c->g->ne;
+  if (fstatat(sfd, s, &st, AT_SYMLINK_NOFOLLOW) < 0)
+    goto e;
+  if (!S_ISDIR(st.st_mode)) {
+    if (fs_copy_ent(c, sfd, s, dfd, d, &st) < 0) goto e;
+    return 0;
+  }
+  if (fs_copy_dir_open(c, dfd, d, 0, &st) < 0)
+    goto e;
+  if (fstat(c->d[0], &ds) < 0)
+    goto ed;
+  if (ds.st_dev == st.st_dev && ds.st_ino == st.st_ino) {
+    errno = EINVAL;
+    goto ed;
+  }
+  if (walk_open(&c->w, sfd, s) < 0)
+    goto ed;
+  c->dev = ds.st_dev;
+  c->ino = ds.st_ino;
+  for (int r; (r = walk_next(&c->w)); ) {
+    usize n = c->w.n;
+    if (r == WALK_ERR)
+      fs_copy_err(c, c->w.e);
+    if (r != WALK_ENT) {
+      fs_copy_dir_close(c, n);
+      continue;
+    }
+    const char *b = c->w.p + c->w.b;
+    int sd = walk_dfd(&c->w);
+    int dd = c->d[n - 1];
+    if (fstatat(sd, b, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+      fs_copy_err(c, errno);
+      continue;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+      if (fs_copy_ent(c, sd, b, dd, b, &st) < 0)
+        fs_copy_err(c, errno);
+      continue;
+    }
+    if (st.st_dev == c->dev && st.st_ino == c->ino) {
+      fs_copy_err(c, ELOOP);
+      continue;
+    }
+    if (n >= WALK_DEPTH) {
+      fs_copy_err(c, ELOOP);
+      continue;
+    }
+    if (fs_copy_dir_open(c, dd, b, n, &st) < 0) {
+      fs_copy_err(c, errno);
+      continue;
+    }
+    if (walk_push(&c->w) < 0) {
+      fs_copy_err(c, errno);
+      close(c->d[n]);
+    }
+  }
+  return c->g->ne == ne ? 0 : -1;
+ed:;
+  int er = errno;
+  close(c->d[0]);
+  errno = er;
+e:
+  fs_prog_err(c->g, s, errno);
+  return -1;
+}
+
+//
+// Create the directory d and any missing parents, like mkdir -p.
+//
+static inline int
+fs_mkdir_p(char *d, mode_t m)
+{
+  for (char *s = d + 1; *s; s++) {
+    if (*s != '/') continue;
+    *s = 0;
+    int r = mkdir(d, m);
+    *s = '/';
+    if (r < 0 && errno != EEXIST) return -1;
+  }
+  return mkdir(d, m) < 0 && errno != EEXIST ? -1 : 0;
+}
+
+//
+// Rename s to d, refusing to replace d when x is set. Where the kernel has
+// no such flag the check is made first, which leaves a window open but still
+// catches the common case of a name that already exists.
+//
+static inline int
+fs_rename(int sfd, const char *s, int dfd, const char *d, bool x)
+{
+  if (x) {
+#if defined(__linux__) && defined(RENAME_NOREPLACE)
+    if (!renameat2(sfd, s, dfd, d, RENAME_NOREPLACE)) return 0;
+    if (errno != EINVAL && errno != ENOSYS) return -1;
+#elif defined(__APPLE__) && defined(RENAME_EXCL)
+    if (!renameatx_np(sfd, s, dfd, d, RENAME_EXCL)) return 0;
+    if (errno != EINVAL && errno != ENOTSUP) return -1;
+#endif
+    struct stat st;
+    if (!fstatat(dfd, d, &st, AT_SYMLINK_NOFOLLOW)) {
+      errno = EEXIST;
+      return -1;
+    }
+  }
+  return renameat(sfd, s, dfd, d);
+}
+
+//
+// Recursive delete.
+//
+// Everything but directories is unlinked as the walk finds it and each
+// directory is removed as the walk leaves it (post-order), relative to its
+// parent. Like copying, a failed entry is counted and the walk carries on.
+//
+struct fs_rm {
+  struct walk w;
+  struct fs_prog *g;
+};
+
+static inline void
+fs_remove_at(struct fs_rm *r, const char *b, int f)
+{
+  if (unlinkat(walk_dfd(&r->w), b, f) < 0)
+    fs_prog_err(r->g, r->w.p, errno);
+  else
+    __atomic_add_fetch(&r->g->nf, 1, __ATOMIC_RELAXED);
+}
+
+static inline int
+fs_remove(struct fs_rm *r, int dfd, const char *s)
+{
+  struct walk *w = &r->w;
+  struct stat st;
+  u64 ne = r->g->ne;
+  if (fstatat(dfd, s, &st, AT_SYMLINK_NOFOLLOW) < 0)
+    goto e;
+  if (!S_ISDIR(st.st_mode)) {
+    if (unlinkat(dfd, s, 0) < 0) goto e;
+    __atomic_add_fetch(&r->g->nf, 1, __ATOMIC_RELAXED);
+    return 0;
+  }
+  if (walk_open(w, dfd, s) < 0)
+    goto e;
+  for (int t; (t = walk_next(w)); ) {
+    const char *b = w->p + w->b;
+    if (t == WALK_ERR)
+      fs_prog_err(r->g, w->p, w->e);
+    if (t != WALK_ENT) {
+      fs_remove_at(r, b, AT_REMOVEDIR);
+      continue;
+    }
+    u8 y = w->t;
+    if (y == WALK_T_UNKNOWN) {
+      if (fstatat(walk_dfd(w), b, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+        fs_prog_err(r->g, w->p, errno);
+        continue;
+      }
+      y = S_ISDIR(st.st_mode) ? WALK_T_DIR : WALK_T_OTHER;
+    }
+    if (y != WALK_T_DIR)
+      fs_remove_at(r, b, 0);
+    else if (walk_push(w) < 0)
+      fs_prog_err(r->g, w->p, errno);
+  }
+  return r->g->ne == ne ? 0 : -1;
+e:
+  fs_prog_err(r->g, s, errno);
+  return -1;
+}
+
+//
+// Recursive chmod and chown.
+//
+// A mode is octal or a list of symbolic clauses as taken by chmod(1), like
+// "u+x,go-w" or "a=rX". Clauses without a who are limited by the umask u.
+// The new mode is computed from the old one o, d telling whether it belongs
+// to a directory for 'X'.
+//
+static inline int
+fs_mode(const char *s, mode_t o, mode_t u, bool d, mode_t *r)
+{
+  mode_t m = o & 07777;
+  if (*s >= '0' && *s <= '7') {
+    for (m = 0; *s >= '0' && *s <= '7' && m <= 0777; s++)
+      m = (mode_t)(m << 3 | (mode_t)(*s - '0'));
+    *r = m;
+    return *s ? -1 : 0;
+  }
+  for (;;) {
+    mode_t w = 0;
+    for (;; s++) {
+      if (*s == 'u')      w |= S_ISUID|S_IRWXU;
+      else if (*s == 'g') w |= S_ISGID|S_IRWXG;
+      else if (*s == 'o') w |= S_ISVTX|S_IRWXO;
+      else if (*s == 'a') w |= 07777;
+      else break;
+    }
+    mode_t k = w ? 07777 : (mode_t) ~u;
+    if (!w) w = 07777;
+    if (*s != '+' && *s != '-' && *s != '=') return -1;
+    while (*s == '+' || *s == '-' || *s == '=') {
+      char op = *s++;
+      mode_t b = 0;
+      if (*s == 'u' || *s == 'g' || *s == 'o') {
+        mode_t c = (m >> (*s == 'u' ? 6 : *s == 'g' ? 3 : 0)) & 7;
+        b = (mode_t)(c << 6 | c << 3 | c);
+        s++;
+      } else for (;; s++) {
+        if (*s == 'r')      b |= 0444;
+        else if (*s == 'w') b |= 0222;
+        else if (*s == 'x') b |= 0111;
+        else if (*s == 'X') b |= d || m & 0111 ? 0111 : 0;
+        else if (*s == 's') b |= S_ISUID|S_ISGID;
+        else if (*s == 't') b |= S_ISVTX;
+        else break;
+      }
+      b &= w & k;
+      if (op == '+')      m |= b;
+      else if (op == '-') m &= ~b;
+      else                m = (m & ~w) | b;
+    }
+    if (*s != ',') break;
+    s++;
+  }
+  *r = m;
+  return *s ? -1 : 0;
+}
+
+//
+// Parse "owner[:group]" into ids, names or numbers, leaving out either side
+// as -1. "owner:" takes the owner's login group.
+//
+static inline int
+fs_owner(char *s, uid_t *u, gid_t *g)
+{
+  char *c = strchr(s, ':');
+  char *e;
+  *u = (uid_t) -1;
+  *g = (gid_t) -1;
+  if (c) *c++ = 0;
+  if (*s) {
+    struct passwd *pw = getpwnam(s);
+    if (pw) *u = pw->pw_uid;
+    else {
+      *u = (uid_t) strtoul(s, &e, 10);
+      if (*e) return -1;
+    }
+    if (c && !*c) {
+      if (!pw && !(pw = getpwuid(*u))) return -1;
+      *g = pw->pw_gid;
+    }
+  }
+  if (c && *c) {
+    struct group *gr = getgrnam(c);
+    if (gr) *g = gr->gr_gid;
+    else {
+      *g = (gid_t) strtoul(c, &e, 10);
+      if (*e) return -1;
+    }
+  }
+  return *u == (uid_t) -1 && *g == (gid_t) -1 ? -1 : 0;
+}
+
+struct fs_attr {
+  struct walk w;
+  struct fs_prog *g;
+  const char *m;
+  mode_t u;
+  uid_t o;
+  gid_t r;
+};
+
+//
+// Change one entry whose mode o is passed in when known or (mode_t)-1. For
+// chmod the new mode lands in *n and nothing is done when it equals the old
+// one, in which case 1 is returned.
+//
+static inline int
+fs_attr_at(struct fs_attr *a, int dfd, const char *s, mode_t o, int f, mode_t *n)
+{
+  struct stat st;
+  if (!a->m)
+    return fchownat(dfd, s, a->o, a->r, f);
+  if (o == (mode_t) -1 && (*a->m < '0' || *a->m > '7')) {
+    if (fstatat(dfd, s, &st, 0) < 0) return -1;
+    o = st.st_mode;
+  }
+  if (fs_mode(a->m, o, a->u, S_ISDIR(o), n) < 0) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (o != (mode_t) -1 && *n == (o & 07777)) return 1;
+  return fchmodat(dfd, s, *n, 0);
+}
+
+//
+// Apply the change to everything below the directory s, which itself is
+// left alone. Symbolic links are skipped by chmod and changed themselves by
+// chown, like chmod -R and chown -R.
+//
+static inline int
+fs_attr(struct fs_attr *a, int dfd, const char *s)
+{
+  struct walk *w = &a->w;
+  struct stat st;
+  mode_t n;
+  u64 ne = a->g->ne;
+  if (fstatat(dfd, s, &st, AT_SYMLINK_NOFOLLOW) < 0) goto e;
+  if (!S_ISDIR(st.st_mode)) return 0;
+  if (walk_open(w, dfd, s) < 0) goto e;
+  for (int t; (t = walk_next(w)); ) {
+    const char *b = w->p + w->b;
+    if (t == WALK_ERR)
+      fs_prog_err(a->g, w->p, w->e);
+    if (t != WALK_ENT) continue;
+    if (fstatat(walk_dfd(w), b, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+      fs_prog_err(a->g, w->p, errno);
+      continue;
+    }
+    if (a->m && S_ISLNK(st.st_mode)) continue;
+    if (fs_attr_at(a, walk_dfd(w), b, st.st_mode, AT_SYMLINK_NOFOLLOW, &n) < 0)
+      fs_prog_err(a->g, w->p, errno);
+    else
+      a->g->nf++;
+    if (S_ISDIR(st.st_mode) && walk_push(w) < 0)
+      fs_prog_err(a->g, w->p, errno);
+  }
+  return a->g->ne == ne ? 0 : -1;
+e:
+  fs_prog_err(a->g, s, errno);
+  return -1;
+}
+
+#endif // DYLAN_FS_H
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Dylan Araps
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef DYLAN_JOURNAL_H
+#define DYLAN_JOURNAL_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "util.h"
+#include "fs.h"
+
+//
+// Undo journal.
+//
+// An append-only log of the renames behind moves, bulk renames and trashes,
+// kept in $XDG_STATE_HOME/dfm/journal. A batch is buffered and written as
+// one record with a single append and no fsync:
+//
+//   u32 length, u32 batch, u8 op, 3 bytes padding, u32 count,
+//   source directory, destination directory,
+//   count pairs of source and destination names,
+//   u32 length
+//
+// Strings end in a NUL. The length is repeated at the end so the last
+// record can be found from the end of the file, and undoing a batch renames
+// each pair back, last first, and truncates its records off. A batch too
+// big for the buffer is split into records that share its number.
+//
+#ifndef JOURNAL_BUF
+#define JOURNAL_BUF (1 << 16)
+#endif
+
+#define JOURNAL_HDR 16
+
+enum {
+  JOURNAL_RENAME,
+  JOURNAL_TRASH,
+};
+
+struct journal {
+  int e;
+  u32 id;
+  u32 n;
+  usize h;
+  usize l;
+  char b[JOURNAL_BUF];
+};
+
+static inline int
+journal_open(int f)
+{
+  cut x = get_env("XDG_STATE_HOME", "");
+  cut h = get_env("HOME", "");
+  char b[PATH_MAX];
+  int n = -1;
+  if (x.l && x.d[0] == '/')
+    n = snprintf(b, sizeof(b), "%s/dfm", x.d);
+  else if (h.l)
+    n = snprintf(b, sizeof(b), "%s/.local/state/dfm", h.d);
+  if (n < 0 || (usize) n + sizeof("/journal") > sizeof(b)) {
+    errno = ENOENT;
+    return -1;
+  }
+  memcpy(b + n, "/journal", sizeof("/journal"));
+  int fd = open(b, f|O_CLOEXEC, 0600);
+  if (fd >= 0 || errno != ENOENT || !(f & O_CREAT)) return fd;
+  b[n] = 0;
+  if (fs_mkdir_p(b, 0700) < 0) return -1;
+  b[n] = '/';
+  return open(b, f|O_CLOEXEC, 0600);
+}
+
+static inline void
+journal_push(struct journal *j, const char *s)
+{
+  usize l = strlen(s) + 1;
+  memcpy(j->b + j->l, s, l);
+  j->l += l;
+}
+
+//
+// Start a batch of renames from the directory sd into dd.
+//
+static inline void
+journal_begin(struct journal *j, u8 op, const char *sd, const char *dd)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_REALTIME, &t);
+  j->id = (u32) t.tv_sec ^ (u32) t.tv_nsec ^ (u32) getpid() << 16;
+  j->e = 0;
+  j->n = 0;
+  memset(j->b, 0, JOURNAL_HDR);
+  j->b[8] = (char) op;
+  j->l = JOURNAL_HDR;
+  journal_push(j, sd);
+  journal_push(j, dd);
+  j->h = j->l;
+}
+
+static inline int
+journal_flush(struct journal *j)
+{
+  if (!j->n) return 0;
+  u32 l = (u32) (j->l + sizeof(l));
+  memcpy(j->b, &l, sizeof(l));
+  memcpy(j->b + 4, &j->id, sizeof(j->id));
+  memcpy(j->b + 12, &j->n, sizeof(j->n));
+  memcpy(j->b + j->l, &l, sizeof(l));
+  j->l = j->h;
+  j->n = 0;
+  int fd = journal_open(O_WRONLY|O_APPEND|O_CREAT);
+  int r = fd < 0 ? -1 : write_all(fd, j->b, l);
+  if (fd >= 0 && close(fd) < 0) r = -1;
+  if (r < 0 && !j->e) j->e = errno;
+  return r;
+}
+
+//
+// Add the rename of s to d to the batch. Failing to write out a full buffer
+// or a pair too long to ever fit in one is remembered and reported by
+// journal_end() so the batch itself goes on.
+//
+static inline void
+journal_add(struct journal *j, const char *s, const char *d)
+{
+  usize l = strlen(s) + strlen(d) + 2 + sizeof(u32);
+  if (j->h + l > sizeof(j->b)) {
+    if (!j->e) j->e = ENAMETOOLONG;
+    return;
+  }
+  if (j->l + l > sizeof(j->b))
+    journal_flush(j);
+  journal_push(j, s);
+  journal_push(j, d);
+  j->n++;
+}
+
+static inline int
+journal_end(struct journal *j)
+{
+  journal_flush(j);
+  if (!j->e) return 0;
+  errno = j->e;
+  return -1;
+}
+
+//
+// Start of the string ending just before e, no further back than b.
+//
+static inline const char *
+journal_prev(const char *b, const char *e)
+{
+  const char *s = e - 1;
+  while (s > b && s[-1]) s--;
+  return s;
+}
+
+//
+// Rename the pairs of one record back, last first. Returns the number put
+// back or -1 when the record is malformed.
+//
+static inline int
+journal_undo_rec(const char *r, u32 l, struct fs_prog *g)
+{
+  const char *e = r + l - sizeof(l);
+  const char *sd = r + JOURNAL_HDR;
+  const char *dd = memchr(sd, 0, (usize) (e - sd));
+  const char *b = dd ? memchr(dd + 1, 0, (usize) (e - dd - 1)) : NULL;
+  if (!b || e[-1]) return -1;
+  dd++;
+  b++;
+  int f = O_RDONLY|O_DIRECTORY|O_CLOEXEC;
+  int sfd = open(sd, f);
+  int dfd = open(dd, f);
+  int ifd = r[8] == JOURNAL_TRASH && dfd >= 0 ? openat(dfd, "../info", f) : -1;
+  int n = 0;
+  if (sfd < 0 || dfd < 0)
+    fs_prog_err(g, sfd < 0 ? sd : dd, errno);
+  else while (e > b) {
+    const char *d = journal_prev(b, e);
+    const char *s = journal_prev(b, d);
+    e = s;
+    if (fs_rename(dfd, d, sfd, s, 1) < 0) {
+      fs_prog_err(g, s, errno);
+      continue;
+    }
+    if (ifd >= 0) {
+      char i[NAME_MAX + sizeof(".trashinfo")];
+      snprintf(i, sizeof(i), "%s.trashinfo", d);
+      unlinkat(ifd, i, 0);
+    }
+    n++;
+  }
+  if (sfd >= 0) close(sfd);
+  if (dfd >= 0) close(dfd);
+  if (ifd >= 0) close(ifd);
+  return n;
+}
+
+//
+// Undo the last batch in the journal and drop it. A record of which nothing
+// could be put back is kept so the undo can be tried again. Returns the
+// number of entries put back, or -1 when the journal could not be read.
+//
+static inline long
+journal_undo(struct fs_prog *g)
+{
+  int fd = journal_open(O_RDWR);
+  if (fd < 0) return errno == ENOENT ? 0 : -1;
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    return -1;
+  }
+  if (!st.st_size) {
+    close(fd);
+    return 0;
+  }
+  usize z = (usize) st.st_size;
+  char *m = mmap(NULL, z, PROT_READ, MAP_SHARED, fd, 0);
+  if (m == MAP_FAILED) {
+    close(fd);
+    return -1;
+  }
+  long n = 0;
+  usize e = z;
+  u32 id = 0;
+  int c = -1;
+  for (bool f = 1; e > JOURNAL_HDR; f = 0) {
+    u32 l;
+    u32 k;
+    memcpy(&l, m + e - sizeof(l), sizeof(l));
+    if (l <= JOURNAL_HDR + sizeof(l) || l > e) break;
+    const char *r = m + e - l;
+    memcpy(&k, r + 4, sizeof(k));
+    if (!f && k != id) break;
+    c = journal_undo_rec(r, l, g);
+    if (c <= 0) break;
+    id = k;
+    n += c;
+    e -= l;
+  }
+  if (e == z && c < 0) {
+    n = -1;
+    errno = EINVAL;
+  }
+  munmap(m, z);
+  if (ftruncate(fd, (off_t) e) < 0) n = -1;
+  close(fd);
+  return n;
+}
+
+#endif // DYLAN_JOURNAL_H
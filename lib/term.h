@@ -40,12 +40,14 @@ enum {
   TERM_LOADED   = 1 << 0,
   TERM_WAIT_WCH = 1 << 1,
   TERM_WAIT_KEY = 1 << 2,
+  TERM_WAIT_FD  = 1 << 3,
 };
 
 static struct term {
   struct termios o;
   int fd;
   int null;
+  int sp[2];
   volatile sig_atomic_t flag;
   volatile sig_atomic_t resize;
   volatile sig_atomic_t dead;
@@ -98,11 +100,33 @@ term_signal_crash(int s)
   kill(getpid(), s);
 }
 
+//
+// Signals that should end term_wait() write a byte to a self-pipe so the
+// wakeup cannot be lost between checking a flag and entering select().
+//
+static inline void
+term_signal_wake(void)
+{
+  if (!TERM || TERM->sp[1] < 0) return;
+  int e = errno;
+  ssize_t r = write(TERM->sp[1], "", 1);
+  (void) r;
+  errno = e;
+}
+
 static inline void
 term_signal_sigwinch(int s)
 {
   (void) s;
   if (TERM) TERM->resize = 1;
+  term_signal_wake();
+}
+
+static inline void
+term_signal_sigchld(int s)
+{
+  (void) s;
+  term_signal_wake();
 }
 
 static inline void
@@ -123,6 +147,27 @@ term_signal_setup(void) {
   sa.sa_flags = 0;
   sa.sa_handler = term_signal_sigwinch;
   sigaction(SIGWINCH, &sa, NULL);
+  sa.sa_flags = SA_RESTART|SA_NOCLDSTOP;
+  sa.sa_handler = term_signal_sigchld;
+  sigaction(SIGCHLD, &sa, NULL);
+}
+
+//
+// Undo term_signal_setup() in a forked child that keeps running our code so
+// it can be killed normally and never touches the terminal.
+//
+static inline void
+term_signal_child(void)
+{
+  TERM = NULL;
+  struct sigaction sa = {0};
+  sa.sa_handler = SIG_DFL;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGINT,   &sa, NULL);
+  sigaction(SIGTERM,  &sa, NULL);
+  sigaction(SIGQUIT,  &sa, NULL);
+  sigaction(SIGWINCH, &sa, NULL);
+  sigaction(SIGCHLD,  &sa, NULL);
 }
 
 static inline int
@@ -155,6 +200,24 @@ term_init_io(struct term *t)
   return t->null;
 }
 
+static inline int
+term_init_pipe(struct term *t)
+{
+  if (pipe(t->sp) < 0) return -1;
+  for (int i = 0; i < 2; i++) {
+    fcntl(t->sp[i], F_SETFD, FD_CLOEXEC);
+    fcntl(t->sp[i], F_SETFL, fcntl(t->sp[i], F_GETFL) | O_NONBLOCK);
+  }
+  return 0;
+}
+
+static inline void
+term_drain_pipe(struct term *t)
+{
+  char b[64];
+  while (read(t->sp[0], b, sizeof(b)) > 0);
+}
+
 static inline int
 term_raw(const struct term *t)
 {
@@ -178,7 +241,9 @@ term_cooked(struct term *t)
 static inline int
 term_init(struct term *t)
 {
+  t->sp[0] = t->sp[1] = -1;
   if (term_init_io(t) < 0) return -1;
+  if (term_init_pipe(t) < 0) return -1;
   if (tcgetattr(t->fd, &t->o) < 0) return -1;
   TERM = t;
   t->flag |= TERM_LOADED;
@@ -192,23 +257,34 @@ term_reap(void)
   for (int st; waitpid(-1, &st, WNOHANG) > 0; );
 }
 
+//
+// Wait for input, a resize, a child exiting or fd becoming readable. A
+// negative fd is ignored. A negative timeout waits forever, zero polls.
+// Returns 0 on timeout or when only a child exited.
+//
 static inline int
-term_wait(struct term *t)
+term_wait(struct term *t, int fd, int ms)
 {
   for (;;) {
     if (t->resize) return TERM_WAIT_WCH;
     fd_set rfds;
     FD_ZERO(&rfds);
     FD_SET(t->fd, &rfds);
-    int r = select(t->fd + 1, &rfds, NULL, NULL, NULL);
+    FD_SET(t->sp[0], &rfds);
+    if (fd >= 0) FD_SET(fd, &rfds);
+    int n = MAX(MAX(t->fd, t->sp[0]), fd) + 1;
+    struct timeval tv = { ms / 1000, (ms % 1000) * 1000 };
+    int r = select(n, &rfds, NULL, NULL, ms < 0 ? NULL : &tv);
     if (r < 0) {
       if (errno != EINTR) return 0;
-      if (t->resize) return TERM_WAIT_WCH;
       continue;
     }
-    if (FD_ISSET(t->fd, &rfds))
-      return TERM_WAIT_KEY;
-    return 0;
+    int e = 0;
+    if (FD_ISSET(t->sp[0], &rfds)) term_drain_pipe(t);
+    if (t->resize) e |= TERM_WAIT_WCH;
+    if (FD_ISSET(t->fd, &rfds)) e |= TERM_WAIT_KEY;
+    if (fd >= 0 && FD_ISSET(fd, &rfds)) e |= TERM_WAIT_FD;
+    return e;
   }
 }
 
@@ -217,6 +293,8 @@ term_destroy(const struct term *t)
 {
   if (t->fd >= 0)   close(t->fd);
   if (t->null >= 0) close(t->null);
+  if (t->sp[0] >= 0) close(t->sp[0]);
+  if (t->sp[1] >= 0) close(t->sp[1]);
   TERM = NULL;
 }
 
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 Dylan Araps
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef DYLAN_TRASH_H
+#define DYLAN_TRASH_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include "util.h"
+#include "fs.h"
+
+//
+// Freedesktop trash.
+// Source: https://specifications.freedesktop.org/trash-spec/latest/
+//
+// An entry is trashed by first claiming a name with its '.trashinfo' file,
+// created with O_EXCL so two programs trashing the same name at once cannot
+// both get it, and then renaming the entry into 'files' under that name. A
+// trash holds either absolute paths (the home trash) or paths relative to
+// the top of the mount it lives on.
+//
+struct trash {
+  int f;
+  int i;
+  dev_t dev;
+  usize tl;
+  char t[PATH_MAX];
+  char p[PATH_MAX];
+  char n[NAME_MAX + 1];
+  char dt[32];
+  char b[(PATH_MAX + NAME_MAX) * 3 + 64];
+};
+
+//
+// Path of the trash's 'files' directory, a followed by b and c.
+//
+static inline int
+trash_path(struct trash *t, const char *a, const char *b, const char *c)
+{
+  int n = snprintf(t->p, sizeof(t->p), "%s%s%s/files", a, b, c);
+  if (n >= 0 && (usize) n < sizeof(t->p)) return 0;
+  errno = ENAMETOOLONG;
+  return -1;
+}
+
+static inline void
+trash_close(struct trash *t)
+{
+  if (t->f >= 0) close(t->f);
+  if (t->i >= 0) close(t->i);
+  t->f = t->i = -1;
+}
+
+static inline int
+trash_open_at(struct trash *t, int fd)
+{
+  int f = O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC;
+  struct stat st;
+  if (mkdirat(fd, "files", 0700) < 0 && errno != EEXIST) return -1;
+  if (mkdirat(fd, "info", 0700) < 0 && errno != EEXIST) return -1;
+  t->f = openat(fd, "files", f);
+  t->i = openat(fd, "info", f);
+  if (t->f < 0 || t->i < 0 || fstat(t->f, &st) < 0) {
+    int e = errno;
+    trash_close(t);
+    errno = e;
+    return -1;
+  }
+  t->dev = st.st_dev;
+  time_t n = time(NULL);
+  struct tm tm;
+  localtime_r(&n, &tm);
+  strftime(t->dt, sizeof(t->dt), "%Y-%m-%dT%H:%M:%S", &tm);
+  return 0;
+}
+
+//
+// Path of the home trash, $XDG_DATA_HOME/Trash or ~/.local/share/Trash.
+//
+static inline int
+trash_home(char *b, usize l)
+{
+  cut x = get_env("XDG_DATA_HOME", "");
+  cut h = get_env("HOME", "");
+  int n = -1;
+  if (x.l && x.d[0] == '/')
+    n = snprintf(b, l, "%s/Trash", x.d);
+  else if (h.l)
+    n = snprintf(b, l, "%s/.local/share/Trash", h.d);
+  if (n < 0 || (usize) n >= l) {
+    errno = ENOENT;
+    return -1;
+  }
+  return n;
+}
+
+//
+// Open the trash directory 'd', creating it and its parents if needed.
+//
+static inline int
+trash_open(struct trash *t, const char *d)
+{
+  t->f = t->i = -1;
+  t->tl = 0;
+  usize l = strlen(d);
+  if (!l || l >= sizeof(t->t)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  memcpy(t->t, d, l + 1);
+  if (trash_path(t, t->t, "", "") < 0) return -1;
+  if (fs_mkdir_p(t->t, 0700) < 0) return -1;
+  int fd = open(t->t, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (fd < 0) return -1;
+  int r = trash_open_at(t, fd);
+  close(fd);
+  return r;
+}
+
+//
+// Open the trash at the top of the mount holding the directory 'p', which
+// is on the device 'dev'. A shared sticky '.Trash' directory is used when
+// the mount has one, '.Trash-$uid' otherwise.
+//
+static inline int
+trash_open_top(struct trash *t, const char *p, usize l, dev_t dev)
+{
+  t->f = t->i = -1;
+  if (!l || l >= sizeof(t->t)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  memcpy(t->t, p, l);
+  t->t[l] = 0;
+  struct stat st;
+  usize n = l;
+  while (n > 1) {
+    usize k = n - 1;
+    while (k && t->t[k] != '/') k--;
+    usize e = k ? k : 1;
+    char c = t->t[e];
+    t->t[e] = 0;
+    int r = stat(t->t, &st);
+    t->t[e] = c;
+    if (r < 0 || st.st_dev != dev) break;
+    n = e;
+  }
+  t->t[n] = 0;
+  t->tl = n + (n > 1);
+  int fd = open(t->t, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (fd < 0) return -1;
+  int f = O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC;
+  int d = -1;
+  char u[32];
+  snprintf(u, sizeof(u), "%u", (unsigned) getuid());
+  if (!fstatat(fd, ".Trash", &st, AT_SYMLINK_NOFOLLOW) &&
+      S_ISDIR(st.st_mode) && st.st_mode & S_ISVTX) {
+    int s = openat(fd, ".Trash", f);
+    if (s >= 0) {
+      if (mkdirat(s, u, 0700) == 0 || errno == EEXIST)
+        d = openat(s, u, f);
+      close(s);
+    }
+    if (d >= 0 && trash_path(t, n > 1 ? t->t : "", "/.Trash/", u) < 0) {
+      close(d);
+      d = -1;
+    }
+  }
+  if (d < 0) {
+    snprintf(t->n, sizeof(t->n), ".Trash-%s", u);
+    if (mkdirat(fd, t->n, 0700) == 0 || errno == EEXIST)
+      d = openat(fd, t->n, f);
+    if (d >= 0 && trash_path(t, n > 1 ? t->t : "", "/", t->n) < 0) {
+      close(d);
+      d = -1;
+    }
+  }
+  close(fd);
+  if (d < 0) return -1;
+  int r = trash_open_at(t, d);
+  close(d);
+  if (!r && t->dev != dev) {
+    trash_close(t);
+    errno = EXDEV;
+    return -1;
+  }
+  return r;
+}
+
+static inline usize
+trash_enc(char *b, const char *s, usize l)
+{
+  static const char H[] = "0123456789ABCDEF";
+  usize n = 0;
+  for (usize i = 0; i < l; i++) {
+    u8 c = (u8) s[i];
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || (c && strchr("/-._~", c)))
+      b[n++] = (char) c;
+    else {
+      b[n++] = '%';
+      b[n++] = H[c >> 4];
+      b[n++] = H[c & 15];
+    }
+  }
+  return n;
+}
+
+static inline void
+trash_unclaim(struct trash *t)
+{
+  snprintf(t->b, sizeof(t->b), "%s.trashinfo", t->n);
+  unlinkat(t->i, t->b, 0);
+}
+
+//
+// Claim a name in the trash for 's' in the directory 'd'. 's' may be a path
+// below 'd', the name is claimed for its last component. Names already taken
+// get a numbered suffix. The claimed name is left in t->n.
+//
+static inline int
+trash_claim(struct trash *t, const char *d, usize dl, const char *s)
+{
+  usize sl = strlen(s);
+  const char *b = basename_l(s, sl);
+  usize bl = sl - (usize) (b - s);
+  if (bl >= sizeof(t->n)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  for (u32 k = 1; k; k++) {
+    if (k == 1) memcpy(t->n, b, bl + 1);
+    else if ((usize) snprintf(t->n, sizeof(t->n), "%s.%u", b, k) >= sizeof(t->n)) {
+      errno = ENAMETOOLONG;
+      return -1;
+    }
+    snprintf(t->b, sizeof(t->b), "%s.trashinfo", t->n);
+    int fd = openat(t->i, t->b, O_WRONLY|O_CREAT|O_EXCL|O_CLOEXEC, 0600);
+    if (fd < 0 && errno == EEXIST) continue;
+    if (fd < 0) return -1;
+    struct stat st;
+    if (!fstatat(t->f, t->n, &st, AT_SYMLINK_NOFOLLOW)) {
+      close(fd);
+      unlinkat(t->i, t->b, 0);
+      continue;
+    }
+    usize o = MIN(t->tl, dl);
+    usize n = (usize) snprintf(t->b, sizeof(t->b), "[Trash Info]\nPath=");
+    n += trash_enc(t->b + n, d + o, dl - o);
+    if (dl > o && d[dl - 1] != '/') t->b[n++] = '/';
+    n += trash_enc(t->b + n, s, sl);
+    n += (usize) snprintf(t->b + n, sizeof(t->b) - n,
+      "\nDeletionDate=%s\n", t->dt);
+    int r = write_all(fd, t->b, n);
+    if (close(fd) < 0) r = -1;
+    if (r < 0) {
+      int e = errno;
+      trash_unclaim(t);
+      errno = e;
+      return -1;
+    }
+    return 0;
+  }
+  errno = EEXIST;
+  return -1;
+}
+
+//
+// Trash 's' in the directory 'sfd', whose path is 'd'. Fails with EXDEV when
+// the trash is on another filesystem, the caller then has to copy it in.
+//
+static inline int
+trash_put(struct trash *t, int sfd, const char *d, usize dl, const char *s)
+{
+  if (trash_claim(t, d, dl, s) < 0) return -1;
+  if (!fs_rename(sfd, s, t->f, t->n, 1)) return 0;
+  int e = errno;
+  trash_unclaim(t);
+  errno = e;
+  return -1;
+}
+
+#endif // DYLAN_TRASH_H
@@ -23,6 +23,7 @@
 #define DYLAN_UTF8_H
 
 #include "util.h"
+#include "utf8_width.h"
 
 static inline usize
 utf8_expected(u8 b)
@@ -33,56 +34,37 @@ utf8_expected(u8 b)
   return L[b >> 3];
 }
 
+//
+// Widths are looked up in a two-level table generated by bin/wcwidth: the
+// first level maps each 256 code point block to a deduplicated second level
+// block holding 2 bits per code point.
+//
 static inline usize
 utf8_width(u32 c)
 {
-  if (c == 0) return 0;
-
-  // Control.
-  if (c < 0x20) return 0;
-  if (c >= 0x7f && c < 0xa0) return 0;
-
-  // Zero width joiner.
-  if (c == 0x200d) return 0;
-
-  // Combining.
-  if ((c >= 0x0300 && c <= 0x036f) ||
-      (c >= 0x1ab0 && c <= 0x1aff) ||
-      (c >= 0x1dc0 && c <= 0x1dff) ||
-      (c >= 0x20d0 && c <= 0x20ff) ||
-      (c >= 0xfe20 && c <= 0xfe2f) ||
-      (c >= 0xe0100 && c <= 0xe01ef))
-    return 0;
-
-  // Variation selectors.
-  if ((c >= 0xfe00 && c <= 0xfe0f))
-    return 0;
-
-  // Emoji modifiers.
-  if (c >= 0x1f3fb && c <= 0x1f3ff)
-    return 0;
-
-  // East asian wide.
-  if ((c >= 0x1100 && c <= 0x115f) ||
-      c == 0x2329 || c == 0x232a ||
-      (c >= 0x2e80 && c <= 0xa4cf && c != 0x303f) ||
-      (c >= 0xac00 && c <= 0xd7a3) ||
-      (c >= 0xf900 && c <= 0xfaff) ||
-      (c >= 0xfe10 && c <= 0xfe19) ||
-      (c >= 0xfe30 && c <= 0xfe6f) ||
-      (c >= 0xff00 && c <= 0xff60) ||
-      (c >= 0xffe0 && c <= 0xffe6) ||
-      (c >= 0x20000 && c <= 0x2fffd) ||
-      (c >= 0x30000 && c <= 0x3fffd))
-    return 2;
-
-  // Emoji block.
-  if ((c >= 0x1f300 && c <= 0x1faff) ||
-      (c >= 0x2600 && c <= 0x27bf) ||
-      (c >= 0x2b50 && c <= 0x2b55))
-    return 2;
+  if (c >= UTF8_WIDTH_MAX) return 1;
+  u8 b = UTF8_WIDTH_S2[UTF8_WIDTH_S1[c >> 8]][(c & 0xff) >> 2];
+  return (b >> ((c & 3) << 1)) & 3;
+}
 
-  return 1;
+//
+// Length of the run of printable ASCII at the start of s, checked a word at
+// a time. Every byte in the run is one column wide.
+//
+static inline usize
+utf8_ascii(const unsigned char *s, usize l)
+{
+  const u64 L = 0x0101010101010101ull;
+  const u64 H = 0x8080808080808080ull;
+  usize i = 0;
+  for (; i + 8 <= l; i += 8) {
+    u64 w;
+    memcpy(&w, s + i, sizeof(w));
+    u64 d = w ^ (L * 0x7f);
+    if ((w | ((w - L * 0x20) & ~w) | ((d - L) & ~d)) & H) break;
+  }
+  while (i < l && s[i] >= 0x20 && s[i] < 0x7f) i++;
+  return i;
 }
 
 //
@@ -142,6 +124,15 @@ utf8_cols(const void *s, usize l, usize *lw)
   const unsigned char *e = p + l;
   *lw = 0;
   while (p < e) {
+    if (*p < 0x80) {
+      usize a = utf8_ascii(p, (usize)(e - p));
+      if (a) {
+        p += a;
+        w += a;
+        *lw = 1;
+        continue;
+      }
+    }
     u32 cp;
     p = utf8_decode((void *)p, &cp);
     *lw = utf8_width(cp);
@@ -157,6 +148,14 @@ utf8_trunc(const char *s, usize l, usize c, usize *oc)
   const unsigned char *e = p + l;
   usize co = 0;
   while (p < e) {
+    if (*p < 0x80) {
+      usize a = utf8_ascii(p, MIN((usize)(e - p), c - co));
+      if (a) {
+        p += a;
+        co += a;
+        continue;
+      }
+    }
     u32 cp;
     const unsigned char *n = utf8_decode((void *)p, &cp);
     usize w = utf8_width(cp);
@@ -35,6 +35,7 @@
 #include <unistd.h>
 
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 
 #define ARR_SIZE(a) ((intptr_t)(sizeof(a) / sizeof(*(a))))
@@ -155,15 +156,35 @@ write_all(int fd, const char *b, usize l)
   return 0;
 }
 
+//
+// Write every segment, resuming after short writes.
+//
 static inline int
-run_cmd(int tty, int in, const char *d, const char *const a[], bool bg)
+writev_all(int fd, struct iovec *v, int n)
+{
+  while (n > 0) {
+    ssize_t r = writev(fd, v, n);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    for (; n > 0 && (usize) r >= v->iov_len; v++, n--)
+      r -= (ssize_t) v->iov_len;
+    if (n > 0) {
+      v->iov_base = (char *) v->iov_base + r;
+      v->iov_len -= (usize) r;
+    }
+  }
+  return 0;
+}
+
+static inline int
+spawn_cmd(int tty, int in, const char *d, const char *const a[], pid_t *o)
 {
   extern char **environ;
   posix_spawn_file_actions_t fa;
   pid_t pid;
   int rc;
-  int st;
-  pid_t r;
   rc = posix_spawn_file_actions_init(&fa);
   if (rc) { errno = rc; return -1; }
   if (in >= 0) {
@@ -208,16 +229,27 @@ run_cmd(int tty, int in, const char *d, const char *const a[], bool bg)
   if (rc) { errno = rc; return -1; }
   goto end; // Silence compiler warning when ifdefs cause no jump.
 end:
-  if (bg) return 0;
-  do r = waitpid(pid, &st, 0);
-  while (r == -1 && errno == EINTR);
-  return r == -1 ? -1 : st;
+  *o = pid;
+  return 0;
 fail_fa:
   posix_spawn_file_actions_destroy(&fa);
   errno = rc;
   return -1;
 }
 
+static inline int
+run_cmd(int tty, int in, const char *d, const char *const a[], bool bg)
+{
+  pid_t pid;
+  int st;
+  pid_t r;
+  if (spawn_cmd(tty, in, d, a, &pid) < 0) return -1;
+  if (bg) return 0;
+  do r = waitpid(pid, &st, 0);
+  while (r == -1 && errno == EINTR);
+  return r == -1 ? -1 : st;
+}
+
 static inline int
 fd_from_buf(const char *b, usize l)
 {
@@ -57,6 +57,10 @@
 #define VT_ICH(n)        VT_ESC "[" #n "@"
 #define VT_DCH1          VT_ESC "[P"
 #define VT_DCH(n)        VT_ESC "[" #n "P"
+#define VT_SU1           VT_ESC "[S"
+#define VT_SU(n)         VT_ESC "[" #n "S"
+#define VT_SD1           VT_ESC "[T"
+#define VT_SD(n)         VT_ESC "[" #n "T"
 #define VT_SGR0          VT_ESC "[m"
 
 //
@@ -155,6 +159,22 @@ vt_dch(str *s, u32 n)
   str_push_c(s, 'P');
 }
 
+static inline void
+vt_su(str *s, u32 n)
+{
+  STR_PUSH(s, VT_ESC "[");
+  str_push_u32(s, n);
+  str_push_c(s, 'S');
+}
+
+static inline void
+vt_sd(str *s, u32 n)
+{
+  STR_PUSH(s, VT_ESC "[");
+  str_push_u32(s, n);
+  str_push_c(s, 'T');
+}
+
 static inline void
 vt_decstbm(str *s, u32 x, u32 y)
 {
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Dylan Araps
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef DYLAN_WALK_H
+#define DYLAN_WALK_H
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "util.h"
+
+//
+// Iterative directory walker.
+//
+// Each level of the tree keeps its directory open and children are opened
+// relative to their parent with openat(). The depth is bounded by WALK_DEPTH
+// which also bounds the number of file descriptors held open at once.
+//
+// walk_next() yields every entry (pre-order) with WALK_ENT. Directories are
+// only entered when the caller asks for it with walk_push(). Once a directory
+// has been exhausted it is yielded a second time with WALK_POST (post-order).
+// The path of the current entry relative to the walk root is in w->p and its
+// basename starts at w->p + w->b. Operations on the entry should be performed
+// relative to walk_dfd().
+//
+#ifndef WALK_DEPTH
+#define WALK_DEPTH 32
+#endif
+
+enum {
+  WALK_END  = 0,
+  WALK_ENT  = 1,
+  WALK_POST = 2,
+  WALK_ERR  = 3,
+};
+
+enum {
+  WALK_T_UNKNOWN = 0,
+  WALK_T_DIR     = 1,
+  WALK_T_LNK     = 2,
+  WALK_T_REG     = 3,
+  WALK_T_OTHER   = 4,
+};
+
+struct walk {
+  DIR *d[WALK_DEPTH];
+  usize o[WALK_DEPTH];
+  usize n;
+  usize l;
+  usize b;
+  int r;
+  int e;
+  u8 t;
+  char p[PATH_MAX];
+};
+
+static inline u8
+walk_type(const struct dirent *e)
+{
+#ifdef DT_DIR
+  switch (e->d_type) {
+  case DT_DIR:     return WALK_T_DIR;
+  case DT_LNK:     return WALK_T_LNK;
+  case DT_REG:     return WALK_T_REG;
+  case DT_UNKNOWN: return WALK_T_UNKNOWN;
+  default:         return WALK_T_OTHER;
+  }
+#else
+  (void) e;
+  return WALK_T_UNKNOWN;
+#endif
+}
+
+static inline int
+walk_dfd(const struct walk *w)
+{
+  return w->n ? dirfd(w->d[w->n - 1]) : w->r;
+}
+
+static inline int
+walk_active(const struct walk *w)
+{
+  return w->n != 0;
+}
+
+static inline DIR *
+walk_opendir(int dfd, const char *s)
+{
+  int fd = openat(dfd, s, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+  if (fd < 0) return NULL;
+  DIR *d = fdopendir(fd);
+  if (!d) close(fd);
+  return d;
+}
+
+//
+// Open 's' relative to 'dfd' as the walk root. Paths are reported relative to
+// 'dfd' and so include 's' as a prefix, unless 's' is "." in which case it is
+// omitted.
+//
+static inline int
+walk_open(struct walk *w, int dfd, const char *s)
+{
+  usize l = strlen(s);
+  if (l + 2 >= sizeof(w->p)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  DIR *d = walk_opendir(dfd, s);
+  if (!d) return -1;
+  memcpy(w->p, s, l + 1);
+  if (l == 1 && *s == '.') l = 0;
+  if (l) w->p[l] = '/';
+  w->r = dfd;
+  w->d[0] = d;
+  w->o[0] = l ? l + 1 : 0;
+  w->n = 1;
+  w->l = l;
+  w->b = 0;
+  w->e = 0;
+  return 0;
+}
+
+static inline int
+walk_next(struct walk *w)
+{
+  while (w->n) {
+    usize o = w->o[w->n - 1];
+    errno = 0;
+    struct dirent *e = readdir(w->d[w->n - 1]);
+    if (!e) {
+      w->e = errno;
+      closedir(w->d[--w->n]);
+      w->l = o ? o - 1 : 0;
+      w->b = w->n ? w->o[w->n - 1] : 0;
+      w->p[w->l] = 0;
+      return w->e ? WALK_ERR : WALK_POST;
+    }
+    const char *s = e->d_name;
+    if (s[0] == '.' && (!s[1] || (s[1] == '.' && !s[2])))
+      continue;
+    usize l = strlen(s);
+    if (o + l + 2 >= sizeof(w->p)) {
+      w->e = ENAMETOOLONG;
+      continue;
+    }
+    memcpy(w->p + o, s, l + 1);
+    w->l = o + l;
+    w->b = o;
+    w->t = walk_type(e);
+    return WALK_ENT;
+  }
+  return WALK_END;
+}
+
+//
+// Descend into the directory last returned by walk_next().
+//
+static inline int
+walk_push(struct walk *w)
+{
+  if (w->n >= WALK_DEPTH) {
+    errno = ELOOP;
+    return -1;
+  }
+  DIR *d = walk_opendir(walk_dfd(w), w->p + w->b);
+  if (!d) return -1;
+  w->p[w->l] = '/';
+  w->d[w->n] = d;
+  w->o[w->n++] = w->l + 1;
+  return 0;
+}
+
+static inline void
+walk_close(struct walk *w)
+{
+  while (w->n) closedir(w->d[--w->n]);
+}
+
+#endif // DYLAN_WALK_H
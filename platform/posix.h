@@ -55,6 +55,13 @@ fs_watch_pump(struct platform *p, const char **s, size_t *l)
   return 0;
 }
 
+static inline int
+fs_watch_fd(const struct platform *p)
+{
+  (void) p;
+  return -1;
+}
+
 static inline void
 fs_watch_free(struct platform *p)
 {